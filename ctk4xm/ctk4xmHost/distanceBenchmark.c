@@ -0,0 +1,390 @@
+/**
+ *  @file distanceBenchmark.c
+ *  @brief Host Program that Benchmarks the Distance Methods, Cycles per Call and Error against a double Great Circle
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Build and run on a workstation, from ctk4xm/ctk4xmHost:
+ *   make distanceBenchmark
+ *   ./distanceBenchmark [-r repeat] > distance.csv
+ *
+ * Random point pairs (fixed seed, latitudes up to 70 Degrees, every bearing) are drawn in distance bands
+ * from 10 m to 10000 km. Each method is timed over all the pairs of a band repeat times (default 20),
+ * cycles per call is rdtsc on x86 (0 elsewhere). The host has a double FPU and 64-bit ulong, the integer
+ * methods are relatively much cheaper than Vincenty on a target without FPU.
+ * Errors are against the double precision great circle on the same sphere (R = 6371008.8 m)
+ * from the rounded 1e-7 Degree coordinates. Vincenty is built with GPS_FLOAT_API and measures the
+ * WGS-84 ellipsoid, so its row is the sphere against ellipsoid difference, not an error of the method.
+ * One CSV row per method and band: method,band,pairs,cyclesPerCall,maxErrorCm,rmsErrorCm,maxRelativeError
+ * Vincenty is then measured on the ellipsoid against reference geodesics, one CSV row per line:
+ * line,distanceM,vincentyCm,referenceCm,errorCm. The references are GeographicLib (C. F. F. Karney,
+ * Algorithms for geodesics, 2013, accurate to 15 nm) from the same 1e-7 Degree coordinates, the first
+ * line is the Geoscience Australia example Flinders Peak to Buninyong (54972.271 m published, 4 mm more
+ * once its coordinates are rounded to 1e-7 Degrees).
+ * Exit status 0 --> Vincenty is within 1 mm of every reference line, besides the rounding to 1 cm.
+ */
+
+#include "config.h"
+
+// Host Program, the target builds compile this file empty
+#ifdef HOST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "distance.h"
+
+/**
+ * Point Pairs per Distance Band
+ */
+#define	BENCHMARK_PAIRS			4096
+
+/**
+ * Quantity Distance Bands
+ */
+#define	BENCHMARK_BANDS			6
+
+/**
+ * Sphere Radius in Meters, the same as distance.c
+ */
+#define	BENCHMARK_RADIUS		6371008.8
+
+/**
+ * Degrees to Radians
+ */
+#define	BENCHMARK_RADIANS		(3.14159265358979323846 / 180.0)
+
+/**
+ * Quantity Ellipsoid Reference Lines
+ */
+#define	BENCHMARK_QTY_LINES		10
+
+/**
+ * Error allowed to Vincenty in Centimeters, 1 mm besides the rounding to 1 cm
+ */
+#define	BENCHMARK_VINCENTY_ERROR	0.6
+
+/**
+ * Distance Method under test
+ */
+typedef ulong (*benchmarkMethod)(slong latitude1, slong longitude1, slong latitude2, slong longitude2);
+
+/**
+ * Lower limit of each Distance Band in Meters, the upper limit is the next one
+ */
+const double benchmarkBandLimit[BENCHMARK_BANDS + 1] = {10.0, 100.0, 1000.0, 10000.0, 100000.0, 1000000.0, 10000000.0};
+
+/**
+ * Name of each Distance Band
+ */
+const char *benchmarkBandName[BENCHMARK_BANDS] = {"10m-100m", "100m-1km", "1km-10km", "10km-100km", "100km-1000km", "1000km-10000km"};
+
+/**
+ * Name of each Ellipsoid Reference Line
+ */
+const char *benchmarkLineName[BENCHMARK_QTY_LINES] = {"flindersPeakBuninyong", "shortHop", "equator", "meridian",
+	"antimeridian", "highLatitude", "newYorkTokyo", "sydneyLondon", "equatorNearlyAntipodal", "nearlyAntipodal"};
+
+/**
+ * Points of each Ellipsoid Reference Line, latitude1, longitude1, latitude2, longitude2 in 1e-7 Degrees
+ */
+const slong benchmarkLinePoints[BENCHMARK_QTY_LINES][4] =
+{
+	{-379510334L, 1444248679L, -376528211L, 1439264955L},
+	{46097100L, -740817500L, 46106000L, -740817500L},
+	{0L, 0L, 0L, 100000000L},
+	{0L, 0L, 600000000L, 0L},
+	{-170000000L, 1795000000L, -165000000L, -1795000000L},
+	{700000000L, 200000000L, 750000000L, -300000000L},
+	{406413000L, -737781000L, 355494000L, 1397798000L},
+	{-339461000L, 1511772000L, 514700000L, -4543000L},
+	{0L, 0L, 0L, 1790000000L},
+	{-300000000L, 0L, 295000000L, 1790000000L}
+};
+
+/**
+ * Reference Geodesic Distance on the WGS-84 Ellipsoid of each Line, Meters
+ */
+const double benchmarkLineDistance[BENCHMARK_QTY_LINES] =
+{
+	54972.275372, 98.417490, 1113194.907933, 6654072.819491, 120128.104350,
+	1707879.714434, 10899319.893767, 17015614.266750, 19926188.851996, 19908947.035518
+};
+
+/**
+ * Points of a Distance Band, 1e-7 Degrees
+ */
+slong benchmarkLatitude1[BENCHMARK_PAIRS];
+slong benchmarkLongitude1[BENCHMARK_PAIRS];
+slong benchmarkLatitude2[BENCHMARK_PAIRS];
+slong benchmarkLongitude2[BENCHMARK_PAIRS];
+
+/**
+ * Reference Great Circle Distance of each Pair, Centimeters
+ */
+double benchmarkReference[BENCHMARK_PAIRS];
+
+/**
+ * State of the Random Number Generator, fixed seed so every run measures the same pairs
+ */
+unsigned long long benchmarkState = 0x2545F4914F6CDD1DULL;
+
+/**
+ * Sink of the results, keeps the timed calls from being optimized away
+ */
+volatile ulong benchmarkSink;
+
+/**
+ * @brief Read the CPU Cycle Counter
+ * @return Cycles, 0 if the host has no cycle counter
+ */
+unsigned long long benchmarkCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+/**
+ * @brief Uniform Random Number, linear congruential generator
+ * @return Random Number 0 to 1
+ */
+double benchmarkRandom()
+{
+	benchmarkState = benchmarkState * 6364136223846793005ULL + 1442695040888963407ULL;
+
+	return (double) (benchmarkState >> 11) / 9007199254740992.0;
+}
+
+/**
+ * @brief Double Precision Great Circle Distance on the Sphere, reference
+ * @param latitude1 Latitude First Point, 1e-7 Degrees
+ * @param longitude1 Longitude First Point, 1e-7 Degrees
+ * @param latitude2 Latitude Second Point, 1e-7 Degrees
+ * @param longitude2 Longitude Second Point, 1e-7 Degrees
+ * @return Distance in Centimeters
+ */
+double benchmarkGreatCircle(slong latitude1, slong longitude1, slong latitude2, slong longitude2)
+{
+	double phi1, phi2, lambda, x, y;
+
+	phi1 = latitude1 * 1e-7 * BENCHMARK_RADIANS;
+	phi2 = latitude2 * 1e-7 * BENCHMARK_RADIANS;
+	lambda = ((double) longitude2 - (double) longitude1) * 1e-7 * BENCHMARK_RADIANS;
+
+	// Atan2 form, accurate from a few centimeters to antipodal points
+	y = hypot(cos(phi2) * sin(lambda), cos(phi1) * sin(phi2) - sin(phi1) * cos(phi2) * cos(lambda));
+	x = sin(phi1) * sin(phi2) + cos(phi1) * cos(phi2) * cos(lambda);
+
+	return atan2(y, x) * BENCHMARK_RADIUS * DISTANCE_SCALE;
+}
+
+/**
+ * @brief Draw the Point Pairs of a Distance Band, destination of a random start, bearing and log-uniform distance
+ * @param band Distance Band
+ */
+void benchmarkPairs(uchar band)
+{
+	uint i;
+	double phi1, lambda1, phi2, lambda2, bearing, angle, longitude;
+
+	for(i = 0; i < BENCHMARK_PAIRS; i++)
+	{
+		phi1 = (benchmarkRandom() * 140.0 - 70.0) * BENCHMARK_RADIANS;
+		lambda1 = (benchmarkRandom() * 360.0 - 180.0) * BENCHMARK_RADIANS;
+		bearing = benchmarkRandom() * 360.0 * BENCHMARK_RADIANS;
+		angle = benchmarkBandLimit[band] * pow(benchmarkBandLimit[band + 1] / benchmarkBandLimit[band], benchmarkRandom()) / BENCHMARK_RADIUS;
+
+		phi2 = asin(sin(phi1) * cos(angle) + cos(phi1) * sin(angle) * cos(bearing));
+		lambda2 = lambda1 + atan2(sin(bearing) * sin(angle) * cos(phi1), cos(angle) - sin(phi1) * sin(phi2));
+
+		// Destination back to -180 to 180 Degrees, pairs may cross the 180 Degrees Meridian
+		longitude = remainder(lambda2 / BENCHMARK_RADIANS, 360.0);
+
+		benchmarkLatitude1[i] = (slong) lround(phi1 / BENCHMARK_RADIANS * 1e7);
+		benchmarkLongitude1[i] = (slong) lround(lambda1 / BENCHMARK_RADIANS * 1e7);
+		benchmarkLatitude2[i] = (slong) lround(phi2 / BENCHMARK_RADIANS * 1e7);
+		benchmarkLongitude2[i] = (slong) lround(longitude * 1e7);
+
+		// Reference from the rounded coordinates, the methods only see those
+		benchmarkReference[i] = benchmarkGreatCircle(benchmarkLatitude1[i], benchmarkLongitude1[i], benchmarkLatitude2[i], benchmarkLongitude2[i]);
+	}
+}
+
+/**
+ * @brief Benchmark one Method over the Pairs of a Band, print a CSV row
+ * @param name Method Name
+ * @param method Distance Method
+ * @param band Distance Band
+ * @param repeat Timed passes
+ */
+void benchmarkRun(const char *name, benchmarkMethod method, uchar band, int repeat)
+{
+	uint i;
+	int pass;
+	ulong sum;
+	ulong distance;
+	double error;
+	double maxError;
+	double maxRelative;
+	double sumSquares;
+	unsigned long long startCycles;
+	unsigned long long cycles;
+
+	maxError = 0;
+	maxRelative = 0;
+	sumSquares = 0;
+
+	// Accuracy Pass
+	for(i = 0; i < BENCHMARK_PAIRS; i++)
+	{
+		distance = method(benchmarkLatitude1[i], benchmarkLongitude1[i], benchmarkLatitude2[i], benchmarkLongitude2[i]);
+
+		if(distance == DISTANCE_INVALID)
+		{
+			continue;
+		}
+
+		error = fabs((double) distance - benchmarkReference[i]);
+		sumSquares += error * error;
+
+		if(error > maxError)
+		{
+			maxError = error;
+		}
+
+		if(error / benchmarkReference[i] > maxRelative)
+		{
+			maxRelative = error / benchmarkReference[i];
+		}
+	}
+
+	// Timed Passes
+	sum = 0;
+	startCycles = benchmarkCycles();
+
+	for(pass = 0; pass < repeat; pass++)
+	{
+		for(i = 0; i < BENCHMARK_PAIRS; i++)
+		{
+			sum += method(benchmarkLatitude1[i], benchmarkLongitude1[i], benchmarkLatitude2[i], benchmarkLongitude2[i]);
+		}
+	}
+
+	cycles = benchmarkCycles() - startCycles;
+	benchmarkSink = sum;
+
+	printf("%s,%s,%u,%.1f,%.2f,%.2f,%.2e\n", name, benchmarkBandName[band], BENCHMARK_PAIRS,
+		(double) cycles / ((double) repeat * BENCHMARK_PAIRS), maxError, sqrt(sumSquares / BENCHMARK_PAIRS), maxRelative);
+}
+
+/**
+ * @brief Measure Vincenty against the Ellipsoid Reference Lines, print a CSV row per line
+ * @return 1 --> Every line within BENCHMARK_VINCENTY_ERROR, 0 --> Failed
+ */
+uchar benchmarkVincentyLines()
+{
+	uchar line;
+	uchar passed;
+	ulong distance;
+	double reference;
+	double error;
+
+	passed = 1;
+
+	printf("line,distanceM,vincentyCm,referenceCm,errorCm\n");
+
+	for(line = 0; line < BENCHMARK_QTY_LINES; line++)
+	{
+		distance = distanceVincenty(benchmarkLinePoints[line][0], benchmarkLinePoints[line][1],
+			benchmarkLinePoints[line][2], benchmarkLinePoints[line][3]);
+		reference = benchmarkLineDistance[line] * DISTANCE_SCALE;
+		error = (double) distance - reference;
+
+		printf("%s,%.3f,%lu,%.3f,%.3f\n", benchmarkLineName[line], benchmarkLineDistance[line],
+			(unsigned long) distance, reference, error);
+
+		if(distance == DISTANCE_INVALID || fabs(error) > BENCHMARK_VINCENTY_ERROR)
+		{
+			passed = 0;
+		}
+	}
+
+	return passed;
+}
+
+/**
+ * @brief Benchmark Program
+ * @param argc Quantity Arguments
+ * @param argv Arguments
+ * @return 0 --> OK, 1 --> Usage or Vincenty out of the reference
+ */
+int main(int argc, char *argv[])
+{
+	int repeat;
+	uchar band;
+
+	repeat = 20;
+
+	if(argc == 3 && !strcmp(argv[1], "-r"))
+	{
+		repeat = atoi(argv[2]);
+	}
+	else if(argc != 1)
+	{
+		repeat = 0;
+	}
+
+	if(repeat < 1)
+	{
+		fprintf(stderr, "usage: %s [-r repeat]\n", argv[0]);
+		return 1;
+	}
+
+	printf("method,band,pairs,cyclesPerCall,maxErrorCm,rmsErrorCm,maxRelativeError\n");
+
+	for(band = 0; band < BENCHMARK_BANDS; band++)
+	{
+		benchmarkPairs(band);
+
+		benchmarkRun("equirectangular", distanceEquirectangular, band, repeat);
+		benchmarkRun("haversine", distanceHaversine, band, repeat);
+		benchmarkRun("vincentyEllipsoid", distanceVincenty, band, repeat);
+	}
+
+	if(!benchmarkVincentyLines())
+	{
+		fprintf(stderr, "distanceBenchmark: FAILED\n");
+		return 1;
+	}
+
+	return 0;
+}
+
+#endif
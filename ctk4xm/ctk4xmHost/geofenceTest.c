@@ -0,0 +1,455 @@
+/**
+ *  @file geofenceTest.c
+ *  @brief Host Program that Tests the Geofences, polygon and circle against a double reference and the enter and exit events
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Build and run on a workstation, from ctk4xm/ctk4xmHost:
+ *   make geofenceTest
+ *   ./geofenceTest > geofence.csv
+ *
+ * Contains: random points (fixed seed) around a concave 1 Km polygon, a 50 Km polygon across the Equator
+ * and the 0 Degrees Meridian and a 500 m circle go through geofenceContains and are compared with a double
+ * reference (crossing number, great circle on the sphere). Points closer to an edge than twice the edge
+ * resolution (box / 16384) or closer to the circle than 10 cm are counted apart, not compared.
+ * One CSV row per fence: points, skipped near the edge, mismatches.
+ * Events: a drive East through a table of 9 fences (U-shaped polygon, circle, 6 distant circles and a
+ * rectangle across the circle, so the inside state uses a second byte) goes through geofenceUpdate.
+ * Exit status 0 --> no mismatch and the events are the expected ones in order, a repeated fix gives none.
+ */
+
+#include "config.h"
+
+// Host Program, the target builds compile this file empty
+#ifdef HOST
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "geofence.h"
+
+/**
+ * Meters per 1e-7 Degree of Latitude, sphere R = 6371008.8 m as distance.c
+ */
+#define	TEST_METERS			1.1119508e-2
+
+/**
+ * Degrees to Radians
+ */
+#define	TEST_RADIANS		(3.14159265358979323846 / 180.0)
+
+/**
+ * Origin of the local fences, 1e-7 Degrees
+ */
+#define	TEST_LATITUDE		46000000L
+#define	TEST_LONGITUDE		-741000000L
+
+/**
+ * Random Points per Fence
+ */
+#define	TEST_QTY_POINTS		20000
+
+/**
+ * Quantity Fences of the Events Table
+ */
+#define	TEST_QTY_FENCES		9
+
+/**
+ * Quantity Expected Events of the Drive
+ */
+#define	TEST_QTY_EVENTS		8
+
+/**
+ * U-shaped Polygon 300 x 300 m, East and North in Meters from the origin
+ */
+const double testShapeU[8][2] = {{0, 0}, {300, 0}, {300, 300}, {200, 300}, {200, 100}, {100, 100}, {100, 300}, {0, 300}};
+
+/**
+ * Rectangle 300 x 200 m across the circle, East and North in Meters from the origin
+ */
+const double testShapeRectangle[4][2] = {{900, 100}, {1200, 100}, {1200, 300}, {900, 300}};
+
+/**
+ * Concave 50 Km Polygon across the Equator and the 0 Degrees Meridian, 1e-7 Degrees
+ */
+const geofenceStructPoint testLarge[5] =
+{
+	{-2000000L, -2500000L}, {-1000000L, 2500000L}, {3000000L, 2000000L}, {500000L, 0L}, {2500000L, -2000000L}
+};
+
+/**
+ * Expected Events of the Drive, fence and event
+ */
+const uchar testExpected[TEST_QTY_EVENTS][2] =
+{
+	{0, GEOFENCE_ENTER}, {0, GEOFENCE_EXIT}, {0, GEOFENCE_ENTER}, {0, GEOFENCE_EXIT},
+	{1, GEOFENCE_ENTER}, {8, GEOFENCE_ENTER}, {1, GEOFENCE_EXIT}, {8, GEOFENCE_EXIT}
+};
+
+/**
+ * Points of the U-shaped Polygon, the Rectangle and the Circle Centers, 1e-7 Degrees
+ */
+geofenceStructPoint testPointsU[8];
+geofenceStructPoint testPointsRectangle[4];
+geofenceStructPoint testCenter;
+geofenceStructPoint testCenterFar;
+
+/**
+ * Fences, the test fences are filled at run time from the local shapes
+ */
+geofenceStructFence testFences[TEST_QTY_FENCES];
+
+/**
+ * Events received by the Callback, fence and event
+ */
+uchar testEvents[2 * TEST_QTY_EVENTS][2];
+int testQtyEvents;
+
+/**
+ * State of the Random Number Generator, fixed seed so every run tests the same points
+ */
+unsigned long long testState = 0x9E3779B97F4A7C15ULL;
+
+/**
+ * @brief Uniform Random Number, linear congruential generator
+ * @return Random Number 0 to 1
+ */
+double testRandom()
+{
+	testState = testState * 6364136223846793005ULL + 1442695040888963407ULL;
+
+	return (double) (testState >> 11) / 9007199254740992.0;
+}
+
+/**
+ * @brief Local Point to Coordinates
+ * @param east East in Meters from the origin
+ * @param north North in Meters from the origin
+ * @param point Point, 1e-7 Degrees
+ */
+void testLocalPoint(double east, double north, geofenceStructPoint *point)
+{
+	(*point).latitude = TEST_LATITUDE + (slong) lround(north / TEST_METERS);
+	(*point).longitude = TEST_LONGITUDE + (slong) lround(east / (TEST_METERS * cos(TEST_LATITUDE * 1e-7 * TEST_RADIANS)));
+}
+
+/**
+ * @brief Fill a Fence, the bounding box is taken from the points
+ * @param fence Fence
+ * @param type GEOFENCE_CIRCLE or GEOFENCE_POLYGON
+ * @param points Points, circle center (1 point) or polygon vertices
+ * @param qtyPoints Quantity Points
+ * @param radius Circle Radius in Centimeters
+ */
+void testFence(geofenceStructFence *fence, uchar type, const geofenceStructPoint *points, uchar qtyPoints, ulong radius)
+{
+	uchar i;
+	slong margin;
+
+	(*fence).type = type;
+	(*fence).radius = radius;
+	(*fence).qtyPoints = qtyPoints;
+	(*fence).points = points;
+	(*fence).boxMin = points[0];
+	(*fence).boxMax = points[0];
+
+	for(i = 1; i < qtyPoints; i++)
+	{
+		(*fence).boxMin.latitude = points[i].latitude < (*fence).boxMin.latitude ? points[i].latitude : (*fence).boxMin.latitude;
+		(*fence).boxMin.longitude = points[i].longitude < (*fence).boxMin.longitude ? points[i].longitude : (*fence).boxMin.longitude;
+		(*fence).boxMax.latitude = points[i].latitude > (*fence).boxMax.latitude ? points[i].latitude : (*fence).boxMax.latitude;
+		(*fence).boxMax.longitude = points[i].longitude > (*fence).boxMax.longitude ? points[i].longitude : (*fence).boxMax.longitude;
+	}
+
+	// Circle box, the radius plus 1% in both axes
+	if(type == GEOFENCE_CIRCLE)
+	{
+		margin = (slong) (radius * 1.01 / (TEST_METERS * 100.0));
+		(*fence).boxMin.latitude -= margin;
+		(*fence).boxMax.latitude += margin;
+		margin = (slong) (margin / cos(points[0].latitude * 1e-7 * TEST_RADIANS));
+		(*fence).boxMin.longitude -= margin;
+		(*fence).boxMax.longitude += margin;
+	}
+}
+
+/**
+ * @brief Double Precision Great Circle Distance on the Sphere, reference
+ * @param point First Point
+ * @param latitude Latitude Second Point, 1e-7 Degrees
+ * @param longitude Longitude Second Point, 1e-7 Degrees
+ * @return Distance in Centimeters
+ */
+double testGreatCircle(const geofenceStructPoint *point, slong latitude, slong longitude)
+{
+	double phi1, phi2, lambda, a;
+
+	phi1 = (*point).latitude * 1e-7 * TEST_RADIANS;
+	phi2 = latitude * 1e-7 * TEST_RADIANS;
+	lambda = ((double) longitude - (double) (*point).longitude) * 1e-7 * TEST_RADIANS;
+
+	a = sin((phi2 - phi1) / 2) * sin((phi2 - phi1) / 2) + cos(phi1) * cos(phi2) * sin(lambda / 2) * sin(lambda / 2);
+
+	return 2.0 * asin(sqrt(a)) * 6371008.8 * 100.0;
+}
+
+/**
+ * @brief Double Precision Polygon Test, reference crossing number and distance to the nearest edge
+ * @param fence Polygon Fence
+ * @param latitude Latitude, 1e-7 Degrees
+ * @param longitude Longitude, 1e-7 Degrees
+ * @param edge Distance to the nearest edge, 1e-7 Degrees
+ * @return 1 --> Inside, 0 --> Outside
+ */
+uchar testPolygon(const geofenceStructFence *fence, slong latitude, slong longitude, double *edge)
+{
+	uchar i, j, inside;
+	double x, y, xi, yi, xj, yj, t, dx, dy, distance;
+
+	x = longitude;
+	y = latitude;
+	inside = 0;
+	*edge = 1e30;
+	j = (*fence).qtyPoints - 1;
+
+	for(i = 0; i < (*fence).qtyPoints; i++)
+	{
+		xi = (*fence).points[i].longitude;
+		yi = (*fence).points[i].latitude;
+		xj = (*fence).points[j].longitude;
+		yj = (*fence).points[j].latitude;
+
+		if((yi > y) != (yj > y) && x < xi + (y - yi) * (xj - xi) / (yj - yi))
+		{
+			inside ^= 1;
+		}
+
+		// Distance to the edge segment
+		t = ((x - xi) * (xj - xi) + (y - yi) * (yj - yi)) / ((xj - xi) * (xj - xi) + (yj - yi) * (yj - yi));
+		t = t < 0 ? 0 : t > 1 ? 1 : t;
+		dx = x - (xi + t * (xj - xi));
+		dy = y - (yi + t * (yj - yi));
+		distance = sqrt(dx * dx + dy * dy);
+
+		if(distance < *edge)
+		{
+			*edge = distance;
+		}
+
+		j = i;
+	}
+
+	return inside;
+}
+
+/**
+ * @brief Contains Test, random points in the bounding box plus 20% against the double reference
+ * @param name Fence Name
+ * @param fence Fence
+ * @return 1 --> No mismatch, 0 --> Failed
+ */
+uchar testContains(const char *name, const geofenceStructFence *fence)
+{
+	int i;
+	int skipped;
+	int mismatches;
+	uchar reference;
+	double span, spanLongitude, margin, edge;
+	slong latitude, longitude;
+
+	span = (double) (*fence).boxMax.latitude - (*fence).boxMin.latitude;
+	spanLongitude = (double) (*fence).boxMax.longitude - (*fence).boxMin.longitude;
+
+	// Twice the edge resolution of geofenceInsidePolygon
+	margin = 2.0 * (span > spanLongitude ? span : spanLongitude) / 16384.0 + 2.0;
+	skipped = mismatches = 0;
+
+	for(i = 0; i < TEST_QTY_POINTS; i++)
+	{
+		latitude = (*fence).boxMin.latitude + (slong) ((testRandom() * 1.4 - 0.2) * span);
+		longitude = (*fence).boxMin.longitude + (slong) ((testRandom() * 1.4 - 0.2) * spanLongitude);
+
+		if((*fence).type == GEOFENCE_CIRCLE)
+		{
+			edge = testGreatCircle(&(*fence).points[0], latitude, longitude);
+			reference = edge <= (*fence).radius;
+
+			if(fabs(edge - (*fence).radius) < 10.0)
+			{
+				skipped++;
+				continue;
+			}
+		}
+		else
+		{
+			reference = testPolygon(fence, latitude, longitude, &edge);
+
+			if(edge < margin)
+			{
+				skipped++;
+				continue;
+			}
+		}
+
+		if(geofenceContains(fence, latitude, longitude) != reference)
+		{
+			mismatches++;
+		}
+	}
+
+	printf("%s,%d,%d,%d\n", name, TEST_QTY_POINTS, skipped, mismatches);
+
+	return mismatches == 0;
+}
+
+/**
+ * @brief Geofence Event Callback, records the events
+ * @param fence Fence Index
+ * @param event GEOFENCE_ENTER or GEOFENCE_EXIT
+ */
+void testCallback(uchar fence, uchar event)
+{
+	if(testQtyEvents < 2 * TEST_QTY_EVENTS)
+	{
+		testEvents[testQtyEvents][0] = fence;
+		testEvents[testQtyEvents][1] = event;
+	}
+
+	testQtyEvents++;
+}
+
+/**
+ * @brief Events Test, drive East at 200 m North through the fences, 10 m between fixes
+ * @return 1 --> Expected events in order and none for a repeated fix, 0 --> Failed
+ */
+uchar testDrive()
+{
+	int i;
+	int fixes;
+	int mismatches;
+	double east;
+	gpsStructNmeaGPRMC fix;
+	geofenceStructPoint point;
+
+	memset(&fix, 0, sizeof(fix));
+	testQtyEvents = 0;
+	mismatches = 0;
+	fixes = 0;
+
+	geofenceInit(testFences, TEST_QTY_FENCES, testCallback);
+
+	for(east = -95.0; east < 1500.0; east += 10.0)
+	{
+		testLocalPoint(east, 200.0, &point);
+
+		fix.sequence++;
+		fix.latitude = point.latitude;
+		fix.longitude = point.longitude;
+		fixes++;
+
+		geofenceUpdate(&fix);
+
+		// Same sequence, already tested
+		if(geofenceUpdate(&fix))
+		{
+			mismatches++;
+		}
+
+		// Inside State of the circle and the rectangle
+		if(geofenceInside(1) != (east >= 600.0 && east <= 1000.0) || geofenceInside(8) != (east >= 900.0 && east <= 1200.0))
+		{
+			mismatches++;
+		}
+	}
+
+	for(i = 0; i < TEST_QTY_EVENTS && i < testQtyEvents; i++)
+	{
+		if(testEvents[i][0] != testExpected[i][0] || testEvents[i][1] != testExpected[i][1])
+		{
+			mismatches++;
+		}
+	}
+
+	printf("drive,%d,%d,%d,%d\n", fixes, TEST_QTY_EVENTS, testQtyEvents, mismatches);
+
+	return testQtyEvents == TEST_QTY_EVENTS && mismatches == 0;
+}
+
+/**
+ * @brief Test Program
+ * @return 0 --> OK, 1 --> Failed
+ */
+int main()
+{
+	uchar i;
+	uchar passed;
+	geofenceStructFence large;
+
+	// Local Fences
+	for(i = 0; i < 8; i++)
+	{
+		testLocalPoint(testShapeU[i][0], testShapeU[i][1], &testPointsU[i]);
+	}
+
+	for(i = 0; i < 4; i++)
+	{
+		testLocalPoint(testShapeRectangle[i][0], testShapeRectangle[i][1], &testPointsRectangle[i]);
+	}
+
+	testLocalPoint(800.0, 200.0, &testCenter);
+	testLocalPoint(800.0, 10000.0, &testCenterFar);
+
+	testFence(&testFences[0], GEOFENCE_POLYGON, testPointsU, 8, 0);
+	testFence(&testFences[1], GEOFENCE_CIRCLE, &testCenter, 1, 20000);
+
+	for(i = 2; i < 8; i++)
+	{
+		testFence(&testFences[i], GEOFENCE_CIRCLE, &testCenterFar, 1, 10000);
+	}
+
+	testFence(&testFences[8], GEOFENCE_POLYGON, testPointsRectangle, 4, 0);
+	testFence(&large, GEOFENCE_POLYGON, testLarge, 5, 0);
+
+	printf("fence,points,skippedNearEdge,mismatches\n");
+
+	passed = testContains("polygonConcave", &testFences[0]);
+	passed &= testContains("polygonLarge", &large);
+
+	// Circle of 500 m for the contains test, 200 m for the drive
+	testFence(&testFences[1], GEOFENCE_CIRCLE, &testCenter, 1, 50000);
+	passed &= testContains("circle", &testFences[1]);
+	testFence(&testFences[1], GEOFENCE_CIRCLE, &testCenter, 1, 20000);
+
+	printf("test,fixes,expectedEvents,events,mismatches\n");
+
+	passed &= testDrive();
+
+	if(!passed)
+	{
+		fprintf(stderr, "geofenceTest: FAILED\n");
+		return 1;
+	}
+
+	return 0;
+}
+
+#endif
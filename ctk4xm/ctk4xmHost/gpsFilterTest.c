@@ -0,0 +1,375 @@
+/**
+ *  @file gpsFilterTest.c
+ *  @brief Host Test of the GPS Position Filter and the Odometer against a synthetic Ground Truth
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Build and run on a workstation, from ctk4xm/ctk4xmHost:
+ *   make gpsFilterTest
+ *   ./gpsFilterTest > filter.csv
+ *
+ * Filter: a 20 minutes drive at 1 Hz (stationary, accelerate to 15 m/s, straight, 200 m radius turn,
+ * brake, stationary) is measured with white noise 1.5 m * HDOP plus a slowly wandering bias (0.3 m steps,
+ * correlation 0.98 per fix), fixed seed. Each fix goes through gpsFilterUpdate, the RMS error against the
+ * ground truth is printed for the raw and the filtered positions by phase, for HDOP 1.0 and 2.0.
+ * Odometer: a straight drive at 10 m/s is sent as NMEA (RMC + GGA) through the parser with GPS_FILTER,
+ * then the receiver jumps 22 Km (reacquisition) and drives on, the jump must not be counted.
+ * Antimeridian: a drive East at 15 m/s across the 180 Degrees Meridian through gpsFilterUpdate.
+ * Exit status 0 --> the filter reduces the error at both HDOP, the odometer is within 3% of the drive and
+ * the antimeridian crossing neither restarts the filter nor leaves -180 to 180 Degrees.
+ */
+
+#include "config.h"
+
+// Host Program, the target builds compile this file empty
+#ifdef HOST
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "uart.h"
+#include "gps.h"
+#include "gpsFilter.h"
+
+/**
+ * Meters per 1e-7 Degree of Latitude, sphere R = 6371008.8 m as distance.c
+ */
+#define	TEST_METERS			1.1119508e-2
+
+/**
+ * Meters per Second to 0.01 Knots
+ */
+#define	TEST_KNOTS			(1.0 / 0.00514444)
+
+/**
+ * Quantity Phases of the synthetic Drive
+ */
+#define	TEST_QTY_PHASES		4
+
+/**
+ * Name of each Phase
+ */
+const char *testPhaseName[TEST_QTY_PHASES] = {"stationary", "straight", "turn", "accelerateBrake"};
+
+/**
+ * State of the Random Number Generator, fixed seed so every run measures the same noise
+ */
+unsigned long long testState = 0x853C49E6748FEA9BULL;
+
+/**
+ * @brief Uniform Random Number, linear congruential generator
+ * @return Random Number greater than 0 up to 1
+ */
+double testRandom()
+{
+	testState = testState * 6364136223846793005ULL + 1442695040888963407ULL;
+
+	return ((double) (testState >> 11) + 1.0) / 9007199254740993.0;
+}
+
+/**
+ * @brief Normal Random Number, Box-Muller
+ * @return Random Number, mean 0 and standard deviation 1
+ */
+double testGauss()
+{
+	return sqrt(-2.0 * log(testRandom())) * cos(2.0 * 3.14159265358979323846 * testRandom());
+}
+
+/**
+ * @brief Filter Test, synthetic drive with noisy fixes through gpsFilterUpdate
+ * @param hdop HDOP of every fix
+ * @return 1 --> Filtered RMS below the raw RMS, 0 --> Failed
+ */
+uchar testFilter(double hdop)
+{
+	int t;
+	uchar phase;
+	double x, y, speed, heading, acceleration;
+	double biasX, biasY, measureX, measureY, filterX, filterY;
+	double cosLatitude;
+	double squaresRaw[TEST_QTY_PHASES];
+	double squaresFiltered[TEST_QTY_PHASES];
+	int fixes[TEST_QTY_PHASES];
+	double totalRaw, totalFiltered;
+	gpsStructNmeaGPRMC fix;
+
+	memset(&fix, 0, sizeof(fix));
+	memset(squaresRaw, 0, sizeof(squaresRaw));
+	memset(squaresFiltered, 0, sizeof(squaresFiltered));
+	memset(fixes, 0, sizeof(fixes));
+
+	x = y = speed = heading = biasX = biasY = 0;
+	cosLatitude = cos(48.0 * 3.14159265358979323846 / 180.0);
+	totalRaw = totalFiltered = 0;
+
+	gpsFilterReset();
+
+	for(t = 0; t < 1200; t++)
+	{
+		// Ground Truth, x East and y North in Meters
+		acceleration = t >= 300 && t < 320 ? 0.75 : t >= 760 && t < 780 ? -0.75 : 0;
+		speed = speed + acceleration > 0 ? speed + acceleration : 0;
+
+		if(t >= 600 && t < 760)
+		{
+			heading += speed / 200.0;
+		}
+
+		x += speed * sin(heading);
+		y += speed * cos(heading);
+
+		if(acceleration != 0)
+		{
+			phase = 3;
+		}
+		else if(speed == 0)
+		{
+			phase = 0;
+		}
+		else
+		{
+			phase = t >= 600 && t < 760 ? 2 : 1;
+		}
+
+		// Measurement, wandering bias plus white noise
+		biasX = 0.98 * biasX + 0.3 * testGauss();
+		biasY = 0.98 * biasY + 0.3 * testGauss();
+		measureX = x + biasX + 1.5 * hdop * testGauss();
+		measureY = y + biasY + 1.5 * hdop * testGauss();
+
+		fix.epoch = 1000 + t;
+		fix.quality.hdop = (uint) (hdop * 100);
+		fix.speedOverGround = (uint) (speed > 0 ? speed * TEST_KNOTS : 3 * fabs(testGauss()));
+		fix.latitude = 480000000L + (slong) lround(measureY / TEST_METERS);
+		fix.longitude = 110000000L + (slong) lround(measureX / (TEST_METERS * cosLatitude));
+
+		gpsFilterUpdate(&fix);
+
+		filterX = (fix.longitude - 110000000L) * TEST_METERS * cosLatitude;
+		filterY = (fix.latitude - 480000000L) * TEST_METERS;
+
+		squaresRaw[phase] += (measureX - x) * (measureX - x) + (measureY - y) * (measureY - y);
+		squaresFiltered[phase] += (filterX - x) * (filterX - x) + (filterY - y) * (filterY - y);
+		fixes[phase]++;
+	}
+
+	for(phase = 0; phase < TEST_QTY_PHASES; phase++)
+	{
+		printf("%.1f,%s,%d,%.2f,%.2f,%.0f\n", hdop, testPhaseName[phase], fixes[phase],
+			sqrt(squaresRaw[phase] / fixes[phase]), sqrt(squaresFiltered[phase] / fixes[phase]),
+			100.0 * (1.0 - sqrt(squaresFiltered[phase] / squaresRaw[phase])));
+
+		totalRaw += squaresRaw[phase];
+		totalFiltered += squaresFiltered[phase];
+	}
+
+	printf("%.1f,all,%d,%.2f,%.2f,%.0f\n", hdop, t, sqrt(totalRaw / t), sqrt(totalFiltered / t),
+		100.0 * (1.0 - sqrt(totalFiltered / totalRaw)));
+
+	return totalFiltered < totalRaw;
+}
+
+/**
+ * @brief Send one NMEA Sentence through the Parser, the checksum is appended
+ * @param body Sentence between '$' and '*'
+ */
+void testSentence(const char *body)
+{
+	char line[100];
+	uchar checksum;
+	const char *character;
+
+	checksum = 0;
+
+	for(character = body; *character; character++)
+	{
+		checksum ^= (uchar) *character;
+	}
+
+	sprintf(line, "$%s*%02X", body, checksum);
+
+	gpsReceiveNMEALine((uchar *) line, (uchar) strlen(line));
+	gpsProcess();
+}
+
+/**
+ * @brief Format a Coordinate as NMEA ddmm.mmmm or dddmm.mmmm
+ * @param field Field Text
+ * @param degrees Coordinate in Degrees, positive
+ * @param digits Quantity Degree Digits
+ */
+void testCoordinate(char *field, double degrees, int digits)
+{
+	int whole;
+
+	whole = (int) degrees;
+
+	sprintf(field, "%0*d%07.4f", digits, whole, (degrees - whole) * 60.0);
+}
+
+/**
+ * @brief Odometer Test, NMEA drive with a reacquisition jump through gpsProcess
+ * @return 1 --> Odometer within 3% of the drive, 0 --> Failed
+ */
+uchar testOdometer()
+{
+	int t;
+	double latitude, longitude, noiseNorth, noiseEast, truth, odometer;
+	char time[16], latitudeField[16], longitudeField[16], body[100];
+
+	gpsInit(uartOpen(SCI1));
+	gpsResetOdometer();
+
+	latitude = 4.65;
+	longitude = 74.08;
+	truth = 0;
+
+	for(t = 0; t < 240; t++)
+	{
+		// 10 m/s North, the fix at 120 s reappears 0.2 Degrees East
+		if(t > 0)
+		{
+			latitude += 10.0 / (TEST_METERS * 1e7);
+			truth += 10.0;
+		}
+
+		if(t == 120)
+		{
+			longitude -= 0.2;
+		}
+
+		noiseNorth = 1.5 * testGauss() / (TEST_METERS * 1e7);
+		noiseEast = 1.5 * testGauss() / (TEST_METERS * 1e7);
+
+		sprintf(time, "12%02d%02d.000", t / 60, t % 60);
+		testCoordinate(latitudeField, latitude + noiseNorth, 2);
+		testCoordinate(longitudeField, longitude + noiseEast, 3);
+
+		sprintf(body, "GPRMC,%s,A,%s,N,%s,W,19.44,0.00,171026,,,A", time, latitudeField, longitudeField);
+		testSentence(body);
+		sprintf(body, "GPGGA,%s,%s,N,%s,W,1,08,1.0,2600.0,M,4.0,M,,0000", time, latitudeField, longitudeField);
+		testSentence(body);
+	}
+
+	odometer = gpsGetOdometer() / 1000.0;
+
+	printf("odometer,%.0f,%.0f,%.1f\n", truth, odometer, 100.0 * (odometer - truth) / truth);
+
+	return fabs(odometer - truth) < 0.03 * truth;
+}
+
+/**
+ * @brief Antimeridian Test, drive East across the 180 Degrees Meridian through gpsFilterUpdate
+ * @return 1 --> No restart, longitude in range and error below 6 m after the first 30 fixes, 0 --> Failed
+ */
+uchar testAntimeridian()
+{
+	int t;
+	int restarts;
+	int outOfRange;
+	double x, measureX, filterX, error, maxError;
+	double cosLatitude;
+	gpsStructNmeaGPRMC fix;
+
+	memset(&fix, 0, sizeof(fix));
+
+	cosLatitude = cos(17.0 * 3.14159265358979323846 / 180.0);
+	restarts = outOfRange = 0;
+	maxError = 0;
+
+	gpsFilterReset();
+
+	for(t = 0; t < 300; t++)
+	{
+		// Ground Truth, x East in Meters from 179.99 Degrees East, crosses the meridian at about 70 s
+		x = 15.0 * t;
+		measureX = x + 1.5 * testGauss();
+
+		fix.epoch = 1000 + t;
+		fix.quality.hdop = 100;
+		fix.speedOverGround = (uint) (15.0 * TEST_KNOTS);
+		fix.latitude = -170000000L + (slong) lround(1.5 * testGauss() / TEST_METERS);
+		fix.longitude = 1799900000L + (slong) lround(measureX / (TEST_METERS * cosLatitude));
+
+		if(fix.longitude > 1800000000L)
+		{
+			fix.longitude -= 1800000000L;
+			fix.longitude -= 1800000000L;
+		}
+
+		if(!gpsFilterUpdate(&fix))
+		{
+			restarts++;
+		}
+
+		if(fix.longitude > 1800000000L || fix.longitude < -1800000000L)
+		{
+			outOfRange++;
+		}
+
+		// Error East, the longitude is unwrapped from 179.99 Degrees East
+		filterX = (fix.longitude < 0 ? fix.longitude + 3600000000.0 : (double) fix.longitude) - 1799900000.0;
+		error = fabs(filterX * TEST_METERS * cosLatitude - x);
+
+		if(t >= 30 && error > maxError)
+		{
+			maxError = error;
+		}
+	}
+
+	printf("antimeridian,%d,%d,%d,%.2f\n", t, restarts, outOfRange, maxError);
+
+	return !restarts && !outOfRange && maxError < 6.0;
+}
+
+/**
+ * @brief Test Program
+ * @return 0 --> OK, 1 --> Failed
+ */
+int main()
+{
+	uchar passed;
+
+	printf("hdop,phase,fixes,rmsRawM,rmsFilteredM,reductionPercent\n");
+
+	passed = testFilter(1.0);
+	passed &= testFilter(2.0);
+
+	printf("test,driveM,odometerM,errorPercent\n");
+
+	passed &= testOdometer();
+
+	printf("test,fixes,restarts,outOfRange,maxErrorM\n");
+
+	passed &= testAntimeridian();
+
+	if(!passed)
+	{
+		fprintf(stderr, "gpsFilterTest: FAILED\n");
+		return 1;
+	}
+
+	return 0;
+}
+
+#endif
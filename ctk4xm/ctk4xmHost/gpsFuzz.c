@@ -0,0 +1,158 @@
+/**
+ *  @file gpsFuzz.c
+ *  @brief Host Fuzzing Harness for the NMEA Receive Path (libFuzzer, AFL or standalone) with AddressSanitizer
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Build and run on a workstation, from ctk4xm/ctk4xmHost:
+ *   make gpsFuzzLibFuzzer && ./gpsFuzzLibFuzzer -timeout=1 corpus	(clang, coverage-guided)
+ *   make gpsFuzz && ./gpsFuzz input ...					(gcc, replays files or Standard Input)
+ *   afl-fuzz -i corpus -o findings -- ./gpsFuzz @@		(gpsFuzz built with CC=afl-gcc)
+ *
+ * Each input restarts the parser and is received three ways:
+ * byte by byte through uartReceiveInterrupt (Line Mode) and gpsProcess, as on the target,
+ * straight into the ISR state machine gpsReceiveNMEASentence with gpsProcess after each byte,
+ * and into gpsReceiveSirfByte when built with -DGPS_SIRF_BINARY.
+ * Every published fix is read back, the sanitizers report any access out of the buffers.
+ */
+
+#include "config.h"
+
+// Host Program, the target builds compile this file empty
+#ifdef HOST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "uart.h"
+#include "gps.h"
+#include "hal/uart.h"
+
+/**
+ * @brief Check the Published Fix, coordinates out of range mean the parser accepted a bad field
+ */
+void fuzzCheckFix()
+{
+	gpsStructNmeaGPRMC fix;
+
+	gpsGetFix(&fix);
+
+	if(fix.sequence && (fix.latitude < -90 * GPS_COORDINATE_SCALE || fix.latitude > 90 * GPS_COORDINATE_SCALE
+		|| fix.longitude < -180 * GPS_COORDINATE_SCALE || fix.longitude > 180 * GPS_COORDINATE_SCALE))
+	{
+		abort();
+	}
+}
+
+/**
+ * @brief libFuzzer Entry Point, one input
+ * @param data Input Bytes
+ * @param size Quantity Bytes
+ * @return 0
+ */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	size_t i;
+
+	// UART Line Mode, the same path as the target
+	gpsInit(uartOpen(SCI1));
+	_hal_uartHostReplay(SCI1, data, size);
+
+	for(i = 0; i <= size; i++)
+	{
+		uartReceiveInterrupt(SCI1);
+		gpsProcess();
+	}
+
+	fuzzCheckFix();
+
+	// Byte State Machine called from the RX ISR
+	gpsInit(uartOpen(SCI1));
+	_hal_uartHostReplay(SCI1, 0, 0);
+
+	for(i = 0; i < size; i++)
+	{
+		gpsReceiveNMEASentence(data[i]);
+		gpsProcess();
+	}
+
+	fuzzCheckFix();
+
+#ifdef GPS_SIRF_BINARY
+	// SiRF Binary Decoder
+	gpsInit(uartOpen(SCI1));
+
+	for(i = 0; i < size; i++)
+	{
+		gpsReceiveSirfByte(data[i]);
+	}
+#endif
+
+	return 0;
+}
+
+#ifndef GPS_FUZZ_LIBFUZZER
+
+/**
+ * Standalone Input Buffer
+ */
+uint8_t fuzzInput[65536];
+
+/**
+ * @brief Standalone and AFL Driver, runs each file given, or Standard Input
+ * @param argc Quantity Arguments
+ * @param argv Input Files
+ * @return 0 --> OK, 1 --> File not readable
+ */
+int main(int argc, char *argv[])
+{
+	FILE *file;
+	size_t size;
+	int argument;
+
+	for(argument = 1; argument < argc || argument == 1; argument++)
+	{
+		file = argument < argc ? fopen(argv[argument], "rb") : stdin;
+
+		if(!file)
+		{
+			fprintf(stderr, "%s: can not read %s\n", argv[0], argv[argument]);
+			return 1;
+		}
+
+		size = fread(fuzzInput, 1, sizeof(fuzzInput), file);
+
+		if(file != stdin)
+		{
+			fclose(file);
+		}
+
+		LLVMFuzzerTestOneInput(fuzzInput, size);
+	}
+
+	return 0;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,251 @@
+/**
+ *  @file gpsPowerTest.c
+ *  @brief Host Test of the GPS Power Scheduler State Machine against a simulated Receiver
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Build and run on a workstation, from ctk4xm/ctk4xmHost:
+ *   make gpsPowerTest
+ *   ./gpsPowerTest > power.csv
+ *
+ * The System Tick is stepped by the program, one hour of TIMER_TICK_US ticks. A simulated receiver toggles
+ * between hibernate and full power at the end of each GPS_ON_OFF pulse, drives GPS_WAKE, and sends one
+ * RMC + GGA per second through the parser from 2 seconds (hot start) after the wake up.
+ * The vehicle is stopped 30 minutes, drives 10 minutes at 40 m/s (interval 12 s, below the minimum hibernate)
+ * and 20 minutes at 10 m/s (interval 49 s). One CSV row per phase: awake percent, wake ups and the longest
+ * gap between fixes after the first fix of the phase, and the interval at the end of the phase.
+ * Exit status 0 --> stopped awake below 10%, no hibernate at 40 m/s, hibernate at 10 m/s with every gap
+ * within the interval.
+ */
+
+#include "config.h"
+
+// Host Program, the target builds compile this file empty
+#ifdef HOST
+
+#include <stdio.h>
+#include <string.h>
+
+#include "uart.h"
+#include "io.h"
+#include "timer.h"
+#include "gps.h"
+#include "gpsPower.h"
+
+/**
+ * System Ticks per Second
+ */
+#define	TEST_TICKS			(1000000UL / TIMER_TICK_US)
+
+/**
+ * Meters per 1e-7 Degree of Latitude
+ */
+#define	TEST_METERS			1.1119508e-2
+
+/**
+ * Receiver Hot Start Time to First Fix in Seconds
+ */
+#define	TEST_HOT_START		2
+
+/**
+ * Quantity Phases of the Drive
+ */
+#define	TEST_QTY_PHASES		3
+
+/**
+ * Name of each Phase
+ */
+const char *testPhaseName[TEST_QTY_PHASES] = {"stopped", "speed40", "speed10"};
+
+/**
+ * Speed of each Phase in Meters per Second
+ */
+const double testPhaseSpeed[TEST_QTY_PHASES] = {0, 40.0, 10.0};
+
+/**
+ * First Second of each Phase and end of the Drive
+ */
+const ulong testPhaseStart[TEST_QTY_PHASES + 1] = {0, 1800, 2400, 3600};
+
+/**
+ * @brief Send one NMEA Sentence through the Parser, the checksum is appended
+ * @param body Sentence between '$' and '*'
+ */
+void testSentence(const char *body)
+{
+	char line[100];
+	uchar checksum;
+	const char *character;
+
+	checksum = 0;
+
+	for(character = body; *character; character++)
+	{
+		checksum ^= (uchar) *character;
+	}
+
+	sprintf(line, "$%s*%02X", body, checksum);
+
+	gpsReceiveNMEALine((uchar *) line, (uchar) strlen(line));
+	gpsProcess();
+}
+
+/**
+ * @brief Send the Fix of one Second, RMC + GGA
+ * @param second Seconds since 12:00:00
+ * @param latitude Latitude, Degrees North
+ * @param speed Speed, Meters per Second
+ */
+void testFix(ulong second, double latitude, double speed)
+{
+	char time[16];
+	char body[100];
+	int whole;
+
+	whole = (int) latitude;
+
+	sprintf(time, "%02u%02u%02u.000", (unsigned int) (12 + second / 3600), (unsigned int) (second / 60 % 60), (unsigned int) (second % 60));
+
+	sprintf(body, "GPRMC,%s,A,%02d%07.4f,N,07404.9010,W,%.2f,0.00,171026,,,A", time, whole, (latitude - whole) * 60.0, speed / 0.514444);
+	testSentence(body);
+	sprintf(body, "GPGGA,%s,%02d%07.4f,N,07404.9010,W,1,08,1.0,2600.0,M,4.0,M,,0000", time, whole, (latitude - whole) * 60.0);
+	testSentence(body);
+}
+
+/**
+ * @brief Test Program
+ * @return 0 --> OK, 1 --> Failed
+ */
+int main()
+{
+	ulong tick;
+	ulong second;
+	ulong wakeTick;
+	ulong lastFix;
+	ulong gap[TEST_QTY_PHASES];
+	ulong awakeTicks[TEST_QTY_PHASES];
+	uint wakeUps[TEST_QTY_PHASES];
+	uint interval[TEST_QTY_PHASES];
+	uchar phaseFix[TEST_QTY_PHASES];
+	uchar phase;
+	uchar awake;
+	uchar onOff;
+	uchar passed;
+	double latitude;
+	gpsStructPowerStats stats;
+
+	memset(gap, 0, sizeof(gap));
+	memset(awakeTicks, 0, sizeof(awakeTicks));
+	memset(wakeUps, 0, sizeof(wakeUps));
+	memset(phaseFix, 0, sizeof(phaseFix));
+
+	gpsInit(uartOpen(SCI1));
+
+	// Receiver in hibernate, gpsPowerInit wakes it up
+	awake = 0;
+	onOff = 0;
+	wakeTick = 0;
+	lastFix = 0;
+	latitude = 4.65;
+	ioDigitalWrite(GPS_WAKE,OFF);
+
+	gpsPowerInit();
+
+	for(tick = 0; tick < testPhaseStart[TEST_QTY_PHASES] * TEST_TICKS; tick++)
+	{
+		timerTickIncrement();
+
+		second = tick / TEST_TICKS;
+
+		for(phase = 0; second >= testPhaseStart[phase + 1]; phase++)
+		{
+		}
+
+		// Receiver toggles at the end of the GPS_ON_OFF pulse
+		if(onOff && !ioDigitalRead(GPS_ON_OFF))
+		{
+			awake ^= 1;
+			wakeTick = tick;
+			ioDigitalWrite(GPS_WAKE,awake);
+
+			if(awake)
+			{
+				wakeUps[phase]++;
+			}
+		}
+
+		onOff = ioDigitalRead(GPS_ON_OFF);
+
+		if(tick % TEST_TICKS == 0)
+		{
+			latitude += testPhaseSpeed[phase] / (TEST_METERS * 1e7);
+
+			// One Fix per Second after the hot start
+			if(awake && tick - wakeTick >= TEST_HOT_START * TEST_TICKS)
+			{
+				testFix(second, latitude, testPhaseSpeed[phase]);
+
+				if(phaseFix[phase] && second - lastFix > gap[phase])
+				{
+					gap[phase] = second - lastFix;
+				}
+
+				phaseFix[phase] = 1;
+				lastFix = second;
+			}
+		}
+
+		if(awake)
+		{
+			awakeTicks[phase]++;
+		}
+
+		gpsPowerProcess();
+		interval[phase] = gpsPowerInterval();
+	}
+
+	printf("phase,seconds,awakePercent,wakeUps,maxGapSeconds,interval\n");
+
+	for(phase = 0; phase < TEST_QTY_PHASES; phase++)
+	{
+		printf("%s,%lu,%.1f,%u,%lu,%u\n", testPhaseName[phase], (unsigned long) (testPhaseStart[phase + 1] - testPhaseStart[phase]),
+			100.0 * awakeTicks[phase] / ((testPhaseStart[phase + 1] - testPhaseStart[phase]) * TEST_TICKS), wakeUps[phase],
+			(unsigned long) gap[phase], interval[phase]);
+	}
+
+	gpsPowerGetStats(&stats);
+	printf("stats,wakeUps,%u,wakeTimeouts,%u,fixTimeouts,%u\n", stats.wakeUps, stats.wakeTimeouts, stats.fixTimeouts);
+
+	passed = 100.0 * awakeTicks[0] < 10.0 * testPhaseStart[1] * TEST_TICKS
+		&& wakeUps[1] <= 1 && gap[1] <= 1
+		&& wakeUps[2] > 1 && gap[2] <= interval[2]
+		&& stats.wakeTimeouts == 0 && stats.fixTimeouts == 0;
+
+	if(!passed)
+	{
+		fprintf(stderr, "gpsPowerTest: FAILED\n");
+		return 1;
+	}
+
+	return 0;
+}
+
+#endif
@@ -0,0 +1,261 @@
+/**
+ *  @file gpsReplay.c
+ *  @brief Host Program that Replays a recorded NMEA Log through the UART RX ISR and the GPS Parser, Throughput Benchmark
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Build and run on a workstation, from ctk4xm/ctk4xmHost:
+ *   make gpsReplay
+ *   ./gpsReplay [-q] [-r repeat] sample.nmea > fixes.csv 2> metrics.csv
+ *
+ * The log is received byte by byte through uartReceiveInterrupt (Line Mode) and parsed by gpsProcess,
+ * the same path as the target. Each new fix is printed as a CSV row on Standard Output (-q to skip).
+ * The log is then replayed repeat times (default 10) for timing only, and one CSV row of metrics is
+ * printed on Standard Error: sentences per second and cycles per byte (rdtsc on x86, 0 elsewhere)
+ * of uartReceiveInterrupt + gpsProcess, and the GPS parser counters of one pass.
+ */
+
+#include "config.h"
+
+// Host Program, the target builds compile this file empty
+#ifdef HOST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "uart.h"
+#include "gps.h"
+#include "hal/uart.h"
+
+/**
+ * @brief Read the CPU Cycle Counter
+ * @return Cycles, 0 if the host has no cycle counter
+ */
+unsigned long long replayCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+/**
+ * @brief Read a Monotonic Clock
+ * @return Seconds
+ */
+double replaySeconds()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Read the whole Log
+ * @param fileName Log File Name
+ * @param length Quantity Bytes read
+ * @return Log Bytes, 0 on error
+ */
+uchar * replayLoad(const char *fileName, ulong *length)
+{
+	FILE *file;
+	uchar *data;
+	long size;
+
+	file = fopen(fileName, "rb");
+
+	if(!file)
+	{
+		return 0;
+	}
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	data = malloc(size > 0 ? size : 1);
+
+	if(data && fread(data, 1, size, file) != (size_t) size)
+	{
+		free(data);
+		data = 0;
+	}
+
+	fclose(file);
+	*length = (ulong) size;
+
+	return data;
+}
+
+/**
+ * @brief Print a GPS Fix as a CSV row
+ * @param fix GPS Fix
+ */
+void replayPrintFix(const gpsStructNmeaGPRMC *fix)
+{
+	printf("%lu,%lu,20%02u-%02u-%02u %02u:%02u:%02u,%ld,%ld,%u,%u,%u,%u,%u,%ld,%u,%u\n",
+		(unsigned long) (*fix).sequence, (unsigned long) (*fix).epoch,
+		(*fix).rtcYear, (*fix).rtcMonth, (*fix).rtcDay, (*fix).rtcHour, (*fix).rtcMinute, (*fix).rtcSecond,
+		(long) (*fix).latitude, (long) (*fix).longitude, (*fix).speedOverGround, (*fix).course,
+		(*fix).quality.fixQuality, (*fix).quality.satellites, (*fix).quality.hdop, (long) (*fix).quality.altitude,
+		(*fix).quality.fixMode, (*fix).quality.pdop);
+}
+
+/**
+ * @brief Replay Program
+ * @param argc Quantity Arguments
+ * @param argv Arguments
+ * @return 0 --> OK, 1 --> Usage or Log not readable
+ */
+int main(int argc, char *argv[])
+{
+	const char *fileName;
+	uchar *data;
+	ulong length;
+	ulong i;
+	int argument;
+	int repeat;
+	int pass;
+	uchar quiet;
+	gpsStructNmeaGPRMC fix;
+	ulong fixSequence;
+	ulong fixes;
+	gpsStructStats stats;
+	ulong sentences;
+	unsigned long long cycles;
+	unsigned long long startCycles;
+	double seconds;
+	double startSeconds;
+
+	fileName = 0;
+	repeat = 10;
+	quiet = 0;
+
+	for(argument = 1; argument < argc; argument++)
+	{
+		if(!strcmp(argv[argument], "-q"))
+		{
+			quiet = 1;
+		}
+		else if(!strcmp(argv[argument], "-r") && argument + 1 < argc)
+		{
+			repeat = atoi(argv[++argument]);
+		}
+		else
+		{
+			fileName = argv[argument];
+		}
+	}
+
+	if(!fileName || repeat < 1)
+	{
+		fprintf(stderr, "usage: %s [-q] [-r repeat] log.nmea\n", argv[0]);
+		return 1;
+	}
+
+	data = replayLoad(fileName, &length);
+
+	if(!data)
+	{
+		fprintf(stderr, "%s: can not read %s\n", argv[0], fileName);
+		return 1;
+	}
+
+	// The receiver stays in hibernate on the host (GPS_WAKE low), gpsInit does not write commands
+	gpsInit(uartOpen(SCI1));
+
+	// Functional Pass, decoded fixes
+	if(!quiet)
+	{
+		printf("sequence,epoch,localTime,latitude,longitude,speed,course,quality,satellites,hdop,altitude,mode,pdop\n");
+	}
+
+	_hal_uartHostReplay(SCI1, data, length);
+	gpsClearStats();
+	fixSequence = 0;
+	fixes = 0;
+
+	for(i = 0; i < length; i++)
+	{
+		uartReceiveInterrupt(SCI1);
+		gpsProcess();
+		gpsGetFix(&fix);
+
+		if(fix.sequence != fixSequence)
+		{
+			fixSequence = fix.sequence;
+			fixes++;
+
+			if(!quiet)
+			{
+				replayPrintFix(&fix);
+			}
+		}
+	}
+
+	gpsGetStats(&stats);
+
+	// Timed Passes, only the receive and parse path
+	cycles = 0;
+	seconds = 0;
+
+	for(pass = 0; pass < repeat; pass++)
+	{
+		_hal_uartHostReplay(SCI1, data, length);
+		startSeconds = replaySeconds();
+		startCycles = replayCycles();
+
+		for(i = 0; i < length; i++)
+		{
+			uartReceiveInterrupt(SCI1);
+			gpsProcess();
+		}
+
+		cycles += replayCycles() - startCycles;
+		seconds += replaySeconds() - startSeconds;
+	}
+
+	sentences = (ulong) stats.sentenceGood + stats.sentenceChecksumError + stats.sentenceOverflow;
+
+	fprintf(stderr, "bytes,sentences,sentencesPerSecond,cyclesPerByte,sentenceGood,sentenceChecksumError,sentenceOverflow,sentenceIgnored,fixRejected,fixes\n");
+	fprintf(stderr, "%lu,%lu,%.0f,%.1f,%u,%u,%u,%u,%u,%lu\n",
+		(unsigned long) length, (unsigned long) sentences,
+		seconds > 0 ? sentences * (double) repeat / seconds : 0.0,
+		length ? (double) cycles / ((double) length * repeat) : 0.0,
+		stats.sentenceGood, stats.sentenceChecksumError, stats.sentenceOverflow, stats.sentenceIgnored, stats.fixRejected,
+		(unsigned long) fixes);
+
+	_hal_uartHostReplay(SCI1, 0, 0);
+	free(data);
+
+	return 0;
+}
+
+#endif
@@ -0,0 +1,284 @@
+/**
+ *  @file gpsTrackTest.c
+ *  @brief Host Test of the GPS Track Simplification against a synthetic Drive with Stops
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Build and run on a workstation, from ctk4xm/ctk4xmHost:
+ *   make gpsTrackTest
+ *   ./gpsTrackTest > track.csv
+ *
+ * A 1 Hz drive with 2 m white noise per axis (fixed seed) goes through gpsTrackUpdate with a 10 m tolerance:
+ * a one hour stop, 5 minutes straight at 15 m/s, a 90 Degrees turn of 200 m radius, 5 minutes straight and
+ * a 10 minutes stop. One CSV row per phase: fixes, points kept and the largest distance from a fix to the
+ * simplified track (double, local plane). Exit status 0 --> the stops keep less than 1% of their fixes and
+ * every fix stays within twice the tolerance (fixes dropped while stopped), the moving ones within it.
+ */
+
+#include "config.h"
+
+// Host Program, the target builds compile this file empty
+#ifdef HOST
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "gpsTrack.h"
+
+/**
+ * Meters per 1e-7 Degree of Latitude, sphere R = 6371008.8 m as distance.c
+ */
+#define	TEST_METERS			1.1119508e-2
+
+/**
+ * Tolerance in Centimeters
+ */
+#define	TEST_TOLERANCE		1000
+
+/**
+ * Quantity Fixes of the Drive
+ */
+#define	TEST_QTY_FIXES		5291
+
+/**
+ * Quantity Phases of the Drive
+ */
+#define	TEST_QTY_PHASES		5
+
+/**
+ * Name of each Phase
+ */
+const char *testPhaseName[TEST_QTY_PHASES] = {"stop", "straight", "turn", "straight", "stop"};
+
+/**
+ * Phase stopped, the dead-band drops fixes
+ */
+const uchar testPhaseStopped[TEST_QTY_PHASES] = {1, 0, 0, 0, 1};
+
+/**
+ * First Fix of each Phase and end of the Drive
+ */
+const int testPhaseStart[TEST_QTY_PHASES + 1] = {0, 3600, 3900, 3921, 4221, TEST_QTY_FIXES};
+
+/**
+ * Fixes sent, Meters East and North of the origin
+ */
+double testFixX[TEST_QTY_FIXES];
+double testFixY[TEST_QTY_FIXES];
+
+/**
+ * Points kept, Meters East and North of the origin, and their fix index
+ */
+double testPointX[TEST_QTY_FIXES];
+double testPointY[TEST_QTY_FIXES];
+int testPointFix[TEST_QTY_FIXES];
+
+/**
+ * Quantity Points kept
+ */
+int testQtyPoints;
+
+/**
+ * State of the Random Number Generator, fixed seed so every run measures the same noise
+ */
+unsigned long long testState = 0xDA3E39CB94B95BDBULL;
+
+/**
+ * @brief Uniform Random Number, linear congruential generator
+ * @return Random Number greater than 0 up to 1
+ */
+double testRandom()
+{
+	testState = testState * 6364136223846793005ULL + 1442695040888963407ULL;
+
+	return ((double) (testState >> 11) + 1.0) / 9007199254740993.0;
+}
+
+/**
+ * @brief Normal Random Number, Box-Muller
+ * @return Random Number, mean 0 and standard deviation 1
+ */
+double testGauss()
+{
+	return sqrt(-2.0 * log(testRandom())) * cos(2.0 * 3.14159265358979323846 * testRandom());
+}
+
+/**
+ * @brief Point Kept Callback, the epoch is the fix index
+ * @param point Point kept
+ */
+void testPointKept(const gpsStructTrackPoint *point)
+{
+	testPointX[testQtyPoints] = testFixX[(*point).epoch];
+	testPointY[testQtyPoints] = testFixY[(*point).epoch];
+	testPointFix[testQtyPoints] = (int) (*point).epoch;
+	testQtyPoints++;
+}
+
+/**
+ * @brief Distance from a Point to a Segment
+ * @param x Point East
+ * @param y Point North
+ * @param x1 Segment Start East
+ * @param y1 Segment Start North
+ * @param x2 Segment End East
+ * @param y2 Segment End North
+ * @return Distance, same unit
+ */
+double testSegmentDistance(double x, double y, double x1, double y1, double x2, double y2)
+{
+	double dx, dy, length, t;
+
+	dx = x2 - x1;
+	dy = y2 - y1;
+	length = dx * dx + dy * dy;
+	t = length > 0 ? ((x - x1) * dx + (y - y1) * dy) / length : 0;
+	t = t < 0 ? 0 : t > 1 ? 1 : t;
+
+	return hypot(x - (x1 + t * dx), y - (y1 + t * dy));
+}
+
+/**
+ * @brief Test Program
+ * @return 0 --> OK, 1 --> Failed
+ */
+int main()
+{
+	int t;
+	int point;
+	uchar phase;
+	uchar passed;
+	double x, y, speed, heading, deviation;
+	double cosLatitude;
+	double maxDeviation[TEST_QTY_PHASES];
+	int points[TEST_QTY_PHASES];
+	gpsStructNmeaGPRMC fix;
+
+	cosLatitude = cos(48.0 * 3.14159265358979323846 / 180.0);
+	x = y = heading = 0;
+	testQtyPoints = 0;
+
+	memset(&fix, 0, sizeof(fix));
+	gpsTrackInit(TEST_TOLERANCE, testPointKept);
+
+	for(t = 0; t < TEST_QTY_FIXES; t++)
+	{
+		// Ground Truth, 15 m/s between the stops, 200 m radius turn
+		speed = t >= testPhaseStart[1] && t < testPhaseStart[4] ? 15.0 : 0;
+
+		if(t >= testPhaseStart[2] && t < testPhaseStart[3])
+		{
+			heading += 3.14159265358979323846 / 2 / (testPhaseStart[3] - testPhaseStart[2]);
+		}
+
+		x += speed * sin(heading);
+		y += speed * cos(heading);
+
+		testFixX[t] = x + 2.0 * testGauss();
+		testFixY[t] = y + 2.0 * testGauss();
+
+		fix.sequence = t + 1;
+		fix.epoch = t;
+		fix.latitude = 480000000L + (slong) lround(testFixY[t] / TEST_METERS);
+		fix.longitude = 110000000L + (slong) lround(testFixX[t] / (TEST_METERS * cosLatitude));
+
+		// Back from the rounded coordinates, the track only sees those
+		testFixY[t] = (fix.latitude - 480000000L) * TEST_METERS;
+		testFixX[t] = (fix.longitude - 110000000L) * TEST_METERS * cosLatitude;
+
+		gpsTrackUpdate(&fix);
+	}
+
+	gpsTrackFlush();
+
+	for(phase = 0; phase < TEST_QTY_PHASES; phase++)
+	{
+		maxDeviation[phase] = 0;
+		points[phase] = 0;
+	}
+
+	// Each fix against the segment of the points kept around it
+	point = 0;
+
+	for(t = 0; t < TEST_QTY_FIXES; t++)
+	{
+		for(phase = 0; t >= testPhaseStart[phase + 1]; phase++)
+		{
+		}
+
+		while(point + 1 < testQtyPoints && testPointFix[point + 1] <= t)
+		{
+			point++;
+		}
+
+		if(testPointFix[point] == t)
+		{
+			points[phase]++;
+			deviation = 0;
+		}
+		else if(point + 1 == testQtyPoints)
+		{
+			// Dropped after the last point kept
+			deviation = hypot(testFixX[t] - testPointX[point], testFixY[t] - testPointY[point]);
+		}
+		else
+		{
+			deviation = testSegmentDistance(testFixX[t], testFixY[t], testPointX[point], testPointY[point], testPointX[point + 1], testPointY[point + 1]);
+		}
+
+		if(deviation > maxDeviation[phase])
+		{
+			maxDeviation[phase] = deviation;
+		}
+	}
+
+	printf("phase,fixes,points,maxDeviationM\n");
+
+	passed = 1;
+
+	for(phase = 0; phase < TEST_QTY_PHASES; phase++)
+	{
+		printf("%s,%d,%d,%.2f\n", testPhaseName[phase], testPhaseStart[phase + 1] - testPhaseStart[phase], points[phase], maxDeviation[phase]);
+
+		if(maxDeviation[phase] > (testPhaseStopped[phase] ? 2 : 1) * TEST_TOLERANCE / 100.0)
+		{
+			passed = 0;
+		}
+	}
+
+	printf("all,%d,%d\n", TEST_QTY_FIXES, testQtyPoints);
+
+	if(points[0] * 100 >= testPhaseStart[1] - testPhaseStart[0] || points[4] * 100 >= testPhaseStart[5] - testPhaseStart[4])
+	{
+		passed = 0;
+	}
+
+	if(!passed)
+	{
+		fprintf(stderr, "gpsTrackTest: FAILED\n");
+		return 1;
+	}
+
+	return 0;
+}
+
+#endif
@@ -0,0 +1,379 @@
+/**
+ *  @file navigationTest.c
+ *  @brief Host Program that Tests the Waypoint Navigation, bearing, distance and waypoints reached
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Build and run on a workstation, from ctk4xm/ctk4xmHost:
+ *   make navigationTest
+ *   ./navigationTest > navigation.csv
+ *
+ * Bearing: navigationBearing is swept every 0.01 Degrees for offsets of 1 m, 1 Km and 20000 Km against
+ * atan2 of the same integer offsets, one CSV row per magnitude with the largest error.
+ * Route: a 1 Hz drive at 10 m/s and 60 Degrees North through 6 waypoints (25 m arrival radius) goes
+ * through navigationUpdate. Waypoint 2 is skipped with navigationSetWaypoint, the same fix is then measured
+ * again to waypoint 3. The last two waypoints are 5 m apart across the last leg, both reached by one fix.
+ * Distance and bearing to the active waypoint are compared with the great circle on the sphere, the turn
+ * with the leg course while heading to the waypoint of the leg.
+ * Exit status 0 --> bearing error below 0.02 Degrees, waypoints 0, 1, 3, 4, 5 reached in order, distance
+ * within 10 cm + 0.01%, bearing within 0.05 Degrees (farther than 10 m), turn within 1 Degree, route finished.
+ */
+
+#include "config.h"
+
+// Host Program, the target builds compile this file empty
+#ifdef HOST
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "navigation.h"
+
+/**
+ * Meters per 1e-7 Degree of Latitude, sphere R = 6371008.8 m as distance.c
+ */
+#define	TEST_METERS			1.1119508e-2
+
+/**
+ * Degrees to Radians
+ */
+#define	TEST_RADIANS		(3.14159265358979323846 / 180.0)
+
+/**
+ * Origin of the Route, 1e-7 Degrees
+ */
+#define	TEST_LATITUDE		600000000L
+#define	TEST_LONGITUDE		107500000L
+
+/**
+ * Quantity Waypoints and Legs driven
+ */
+#define	TEST_QTY_WAYPOINTS	6
+#define	TEST_QTY_LEGS		4
+
+/**
+ * Quantity Waypoints expected to be reached
+ */
+#define	TEST_QTY_REACHED	5
+
+/**
+ * Arrival Radius in Centimeters
+ */
+#define	TEST_ARRIVAL		2500
+
+/**
+ * Quantity Bearing Magnitudes
+ */
+#define	TEST_QTY_MAGNITUDES	3
+
+/**
+ * Waypoints, East and North in Meters from the origin
+ */
+const double testRoute[TEST_QTY_WAYPOINTS][2] = {{0, 800}, {800, 800}, {800, 0}, {200, -300}, {1200, -300}, {1200, -295}};
+
+/**
+ * Waypoint driven to on each Leg, waypoint 2 is skipped
+ */
+const uchar testLeg[TEST_QTY_LEGS] = {0, 1, 3, 4};
+
+/**
+ * Waypoints expected to be reached, in order
+ */
+const uchar testExpected[TEST_QTY_REACHED] = {0, 1, 3, 4, 5};
+
+/**
+ * Bearing Offset Magnitudes
+ */
+const double testMagnitude[TEST_QTY_MAGNITUDES] = {100.0, 100000.0, 2000000000.0};
+
+/**
+ * Waypoints, 1e-7 Degrees
+ */
+navigationStructWaypoint testWaypoints[TEST_QTY_WAYPOINTS];
+
+/**
+ * Waypoints reached by the Callback
+ */
+uchar testReached[TEST_QTY_WAYPOINTS];
+int testQtyReached;
+
+/**
+ * @brief Waypoint Reached Callback, records the waypoints
+ * @param waypoint Waypoint Index
+ */
+void testCallback(uchar waypoint)
+{
+	if(testQtyReached < TEST_QTY_WAYPOINTS)
+	{
+		testReached[testQtyReached] = waypoint;
+	}
+
+	testQtyReached++;
+}
+
+/**
+ * @brief Angle Difference wrapped to -180 to 180 Degrees
+ * @param difference Difference in Degrees
+ * @return Difference in Degrees
+ */
+double testWrap(double difference)
+{
+	return remainder(difference, 360.0);
+}
+
+/**
+ * @brief Bearing Test, sweep every 0.01 Degrees against atan2
+ * @param magnitude Offset Magnitude
+ * @return 1 --> Error below 0.02 Degrees and bearing below 360 Degrees, 0 --> Failed
+ */
+uchar testBearing(double magnitude)
+{
+	int step;
+	slong north;
+	slong east;
+	uint bearing;
+	double reference;
+	double error;
+	double maxError;
+	uchar valid;
+
+	maxError = 0;
+	valid = 1;
+
+	for(step = 0; step < 36000; step++)
+	{
+		north = (slong) lround(magnitude * cos(step * 0.01 * TEST_RADIANS));
+		east = (slong) lround(magnitude * sin(step * 0.01 * TEST_RADIANS));
+
+		bearing = navigationBearing(north, east);
+		reference = atan2((double) east, (double) north) / TEST_RADIANS;
+		error = fabs(testWrap(bearing * 0.01 - reference));
+
+		if(bearing >= 36000)
+		{
+			valid = 0;
+		}
+
+		if(error > maxError)
+		{
+			maxError = error;
+		}
+	}
+
+	printf("bearing,%.0f,36000,%.4f\n", magnitude, maxError);
+
+	return valid && maxError < 0.02;
+}
+
+/**
+ * @brief Route Test, drive the legs at 10 m/s through navigationUpdate
+ * @return 1 --> Waypoints reached in order, distance, bearing and turn within the limits, 0 --> Failed
+ */
+uchar testDrive()
+{
+	uchar leg;
+	uchar i;
+	uchar qtyReached;
+	uchar maxQtyReached;
+	int fixes;
+	int mismatches;
+	double east, north, legEast, legNorth, length, course, step;
+	double phi1, phi2, lambda, a, distance, bearing;
+	double error, maxDistanceError, maxBearingError, maxTurn;
+	navigationStructResult result;
+	const navigationStructWaypoint *waypoint;
+	gpsStructNmeaGPRMC fix;
+
+	memset(&fix, 0, sizeof(fix));
+	testQtyReached = 0;
+	mismatches = 0;
+	fixes = 0;
+	maxQtyReached = 0;
+	maxDistanceError = maxBearingError = maxTurn = 0;
+	east = north = 0;
+
+	navigationInit(testWaypoints, TEST_QTY_WAYPOINTS, TEST_ARRIVAL, testCallback);
+
+	for(leg = 0; leg < TEST_QTY_LEGS; leg++)
+	{
+		legEast = testRoute[testLeg[leg]][0] - east;
+		legNorth = testRoute[testLeg[leg]][1] - north;
+		length = sqrt(legEast * legEast + legNorth * legNorth);
+		course = atan2(legEast, legNorth) / TEST_RADIANS;
+		course = course < 0 ? course + 360.0 : course;
+
+		for(step = 10.0; step < length + 10.0; step += 10.0)
+		{
+			// Last fix of the leg on the waypoint
+			east = testRoute[testLeg[leg]][0] - legEast * (1.0 - (step < length ? step / length : 1.0));
+			north = testRoute[testLeg[leg]][1] - legNorth * (1.0 - (step < length ? step / length : 1.0));
+
+			fix.sequence++;
+			fix.latitude = TEST_LATITUDE + (slong) lround(north / TEST_METERS);
+			fix.longitude = TEST_LONGITUDE + (slong) lround(east / (TEST_METERS * cos(TEST_LATITUDE * 1e-7 * TEST_RADIANS)));
+			fix.speedOverGround = (uint) (10.0 / 0.00514444);
+			fix.course = (uint) lround(course * 100.0) % 36000;
+			fixes++;
+
+			qtyReached = navigationUpdate(&fix);
+
+			// Same sequence, already used
+			if(navigationUpdate(&fix))
+			{
+				mismatches++;
+			}
+
+			maxQtyReached = qtyReached > maxQtyReached ? qtyReached : maxQtyReached;
+
+			navigationGetResult(&result);
+
+			if(result.state != NAVIGATION_ACTIVE)
+			{
+				continue;
+			}
+
+			// Reference to the active waypoint
+			waypoint = &testWaypoints[result.waypoint];
+			phi1 = fix.latitude * 1e-7 * TEST_RADIANS;
+			phi2 = (*waypoint).latitude * 1e-7 * TEST_RADIANS;
+			lambda = ((double) (*waypoint).longitude - fix.longitude) * 1e-7 * TEST_RADIANS;
+			a = sin((phi2 - phi1) / 2) * sin((phi2 - phi1) / 2) + cos(phi1) * cos(phi2) * sin(lambda / 2) * sin(lambda / 2);
+			distance = 2.0 * asin(sqrt(a)) * 6371008.8 * 100.0;
+			bearing = atan2(sin(lambda) * cos(phi2), cos(phi1) * sin(phi2) - sin(phi1) * cos(phi2) * cos(lambda)) / TEST_RADIANS;
+
+			error = fabs(result.distance - distance);
+
+			if(error > maxDistanceError)
+			{
+				maxDistanceError = error;
+			}
+
+			if(error > 10.0 + 1e-4 * distance)
+			{
+				mismatches++;
+			}
+
+			if(distance > 1000.0)
+			{
+				error = fabs(testWrap(result.bearing * 0.01 - bearing));
+
+				if(error > maxBearingError)
+				{
+					maxBearingError = error;
+				}
+
+				if(error > 0.05)
+				{
+					mismatches++;
+				}
+			}
+
+			// Heading to the waypoint of the leg, the turn is only the rounding of the course
+			if(result.waypoint == testLeg[leg] && distance > 5000.0)
+			{
+				error = fabs(result.turn * 0.01);
+
+				if(error > maxTurn)
+				{
+					maxTurn = error;
+				}
+
+				if(error > 1.0)
+				{
+					mismatches++;
+				}
+			}
+		}
+
+		// The driver skips waypoint 2 after waypoint 1, the same fix is measured again to waypoint 3
+		if(testLeg[leg] == 1)
+		{
+			navigationSetWaypoint(3);
+			navigationUpdate(&fix);
+			navigationGetResult(&result);
+
+			if(result.waypoint != 3 || result.distance < 100000)
+			{
+				mismatches++;
+			}
+		}
+	}
+
+	navigationGetResult(&result);
+
+	// The last two waypoints are passed by one fix
+	if(maxQtyReached != 2 || result.state != NAVIGATION_FINISHED || result.distance || result.turn)
+	{
+		mismatches++;
+	}
+
+	for(i = 0; i < TEST_QTY_REACHED && i < testQtyReached; i++)
+	{
+		if(testReached[i] != testExpected[i])
+		{
+			mismatches++;
+		}
+	}
+
+	printf("route,%d,%d,%.2f,%.4f,%.2f,%d\n", fixes, testQtyReached, maxDistanceError, maxBearingError, maxTurn, mismatches);
+
+	return testQtyReached == TEST_QTY_REACHED && mismatches == 0;
+}
+
+/**
+ * @brief Test Program
+ * @return 0 --> OK, 1 --> Failed
+ */
+int main()
+{
+	uchar i;
+	uchar passed;
+
+	for(i = 0; i < TEST_QTY_WAYPOINTS; i++)
+	{
+		testWaypoints[i].latitude = TEST_LATITUDE + (slong) lround(testRoute[i][1] / TEST_METERS);
+		testWaypoints[i].longitude = TEST_LONGITUDE + (slong) lround(testRoute[i][0] / (TEST_METERS * cos(TEST_LATITUDE * 1e-7 * TEST_RADIANS)));
+	}
+
+	printf("test,magnitude,samples,maxErrorDegrees\n");
+
+	passed = 1;
+
+	for(i = 0; i < TEST_QTY_MAGNITUDES; i++)
+	{
+		passed &= testBearing(testMagnitude[i]);
+	}
+
+	printf("test,fixes,reached,maxDistanceErrorCm,maxBearingErrorDegrees,maxTurnDegrees,mismatches\n");
+
+	passed &= testDrive();
+
+	if(!passed)
+	{
+		fprintf(stderr, "navigationTest: FAILED\n");
+		return 1;
+	}
+
+	return 0;
+}
+
+#endif
@@ -46,9 +46,9 @@
 
 /**
  * @brief Adafruit Printer Init
- * @param uartId UART Id
+ * @param uart UART Handle connected to the Printer
  */
-void adafruitPrinterInit(uchar uartId);
+void adafruitPrinterInit(uartStructHandle *uart);
 
 /**
  * @brief Print a Chraracter
@@ -0,0 +1,89 @@
+/**
+ *  @file calendar.h
+ *  @brief Module that converts Civil Dates, Time Zones and Unix Time
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CALENDAR_H_
+#define CALENDAR_H_
+
+#include "config.h"
+
+/**
+ * Seconds per Day
+ */
+#define	CALENDAR_DAY_SECONDS	86400UL
+
+/**
+ * Time Zone Step in Seconds, Time Zones are in 15 Minutes steps
+ */
+#define	CALENDAR_ZONE_SECONDS	900
+
+/**
+ * Time Zone from Hours and Minutes, same sign (Ex. UTC-3:30 --> CALENDAR_ZONE(-3, -30))
+ */
+#define	CALENDAR_ZONE(hours, minutes)	((hours) * 4 + (minutes) / 15)
+
+/**
+ * Struct Civil Date and Time
+ * year --> Full Year (Ex. 2013), month --> 1 to 12, day --> 1 to 31
+ */
+typedef struct
+{
+	uint year;
+	uchar month;
+	uchar day;
+	uchar hour;
+	uchar minute;
+	uchar second;
+} calendarStructDateTime;
+
+/**
+ * @brief Days from Civil Date, proleptic Gregorian calendar
+ * @param year Full Year
+ * @param month Month 1 to 12
+ * @param day Day 1 to 31
+ * @return Days since 01/01/1970, negative before
+ */
+slong calendarDaysFromCivil(uint year, uchar month, uchar day);
+
+/**
+ * @brief Civil Date from Days, inverse of calendarDaysFromCivil
+ * @param days Days since 01/01/1970, from 01/03/0000
+ * @param dateTime Year, Month and Day are written, time is not changed
+ */
+void calendarCivilFromDays(slong days, calendarStructDateTime *dateTime);
+
+/**
+ * @brief Unix Time from Civil Date and Time
+ * @param dateTime Date and Time, UTC
+ * @return Seconds since 01/01/1970 00:00:00 UTC, valid from 1970 to 2105
+ */
+ulong calendarToEpoch(const calendarStructDateTime *dateTime);
+
+/**
+ * @brief Civil Date and Time from Unix Time
+ * @param epoch Seconds since 01/01/1970 00:00:00
+ * @param timeZone Time Zone in 15 Minutes steps added to the epoch (Ex. UTC-5 --> -20, UTC+5:30 --> 22)
+ * @param dateTime Local Date and Time
+ */
+void calendarFromEpoch(ulong epoch, signed char timeZone, calendarStructDateTime *dateTime);
+
+#endif
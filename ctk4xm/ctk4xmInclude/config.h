@@ -25,9 +25,12 @@
 #define CONFIG_H_
 
 /**
- * Microcontroller Platform Select
+ * Microcontroller Platform Select, TIM unless the compiler defines one (Ex. gcc -DHOST)
+ * TIM --> MSP430G2553, FREESCALE --> HCS08, HOST --> Workstation build of the generic modules (ctk4xmHost)
  */
+#if !defined(TIM) && !defined(FREESCALE) && !defined(HOST)
 #define	TIM
+#endif
 
 /**
  * Frequency Bus Clock --> Default 20MHz
@@ -38,6 +41,105 @@
 
 #define	SCI2_BPS		9600UL
 
+/**
+ * System Tick Period in us (timerGetTick), set by display7SegInit
+ */
+#define	TIMER_TICK_US	2000UL
+
+/**
+ * TIM RAM Budget (MSP430G2553, 512 B), static data of the application, clang -target msp430 type sizes (not a link map)
+ * gps 326 B (Line Pool 176, Fix Buffers 80), uart 44 B, display7Seg 31 B, gpsFilter 21 B, hal/tim/uart 5 B, timer 4 B --> 431 B
+ * The CCS project reserves an 80 B stack and no heap (nothing calls malloc), the UART and GPS sizes below keep it within RAM
+ */
+
+/**
+ * Quantity UART Ports, 1 on TIM (512 B RAM) for the GPS on SCI1, 2 for the Adafruit Printer on SCI2
+ */
+#ifdef TIM
+#define	UART_QTY_PORTS		1
+#else
+#define	UART_QTY_PORTS		2
+#endif
+
+/**
+ * UART Receive Ring Buffer Size (Power of 2, Max 128)
+ * 4 on TIM (512 B RAM), NMEA is received in Line Mode, raise it for GPS_SIRF_BINARY
+ */
+#ifdef TIM
+#define	UART_RX_BUFFER_SIZE	4
+#else
+#define	UART_RX_BUFFER_SIZE	32
+#endif
+
+/**
+ * UART Transmit Queue Size (Power of 2, Max 128)
+ * 4 on TIM (512 B RAM), GPS Commands are written blocking and the printer retries a full queue
+ */
+#ifdef TIM
+#define	UART_TX_BUFFER_SIZE	4
+#else
+#define	UART_TX_BUFFER_SIZE	32
+#endif
+
+/**
+ * UART Line Mode Quantity Lines per Pool (Power of 2)
+ */
+#define	UART_LINE_QTY		2
+
+/**
+ * UART Line Mode Line Size, NMEA 0183 Sentence Max 82 Characters
+ */
+#define	UART_LINE_SIZE		84
+
+/**
+ * UART Last Error and Idle Line Timestamp with System Tick (timerGetTick), off on TIM (512 B RAM), comment to disable
+ */
+#ifndef TIM
+#define	UART_TIMESTAMP
+#endif
+
+/**
+ * UART RX ISR Worst-Case Duration in Timer Counts (rxIsrMaxCount), uncomment to enable
+ */
+//#define	UART_ISR_PROFILE
+
+/**
+ * GPS Float Wrappers over the Fixed-Point Values and Vincenty Distance (math.h), uncomment to enable
+ */
+//#define	GPS_FLOAT_API
+
+/**
+ * GPS Local Time Zone in 15 Minutes steps (Ex. UTC-5 --> -20, UTC+5:30 --> 22)
+ */
+#define	GPS_TIME_ZONE		-20
+
+/**
+ * GPS Receiver Configuration sent by gpsInit, GPS_SIRF or GPS_MTK, comment both to keep the receiver defaults
+ * Unused NMEA Sentences (GLL, GSV, VTG) are turned off, GGA, GSA and RMC are kept
+ */
+#define	GPS_SIRF
+//#define	GPS_MTK
+
+/**
+ * GPS SiRF Binary Protocol instead of NMEA, only Geodetic Navigation Data (MID 41) is output, uncomment to enable
+ */
+//#define	GPS_SIRF_BINARY
+
+/**
+ * GPS Fix Rate 1 to 10 Hz, set on GPS_MTK only (SiRF is 1 Hz), 5 Hz or more needs SCI1_BPS 38400 or more, GPS_FILTER needs 1 Hz
+ */
+#define	GPS_FIX_RATE		1
+
+/**
+ * GPS Position Filter (alpha-beta) between the parser and the published fix, comment to publish the receiver position
+ */
+#define	GPS_FILTER
+
+/**
+ * GPS Power Scheduler (gpsPower) in the application, hibernates the receiver between fixes, uncomment to enable
+ */
+//#define	GPS_POWER
+
 /**
  * General Include Definition Section
  */
@@ -61,6 +163,20 @@
  */
 #include <hidef.h>
 
+#endif
+
+#ifdef HOST
+
+/**
+ * Host Simulated Ports, 8 Registers per Port (hal/host/io.c)
+ */
+extern volatile unsigned char hostPort1[8];
+extern volatile unsigned char hostPort2[8];
+
+#endif
+
+#if defined(FREESCALE) || defined(HOST)
+
 /**
  * Mask Bit 0
  */
@@ -133,13 +249,13 @@
 	#define LCD_D6				&P2OUT,BIT4
 	#define LCD_D7				&P2OUT,BIT5
 
-	// GPS Module Pins Definition
-	#define GPS_TX				&P2OUT,BIT0
-	#define GPS_RX				&P2OUT,BIT1
+	// GPS Module Pins Definition (SCI1 --> USCI_A0)
+	#define GPS_TX				&P1OUT,BIT2
+	#define GPS_RX				&P1OUT,BIT1
 	#define GPS_ON_OFF			&P2OUT,BIT6
-	#define GPS_WAKE			&P2OUT,BIT5
+	#define GPS_WAKE			&P2IN,BIT5
 
-	// Adafruit Printer Pins Definition
+	// Adafruit Printer Pins Definition (SCI2 --> Timer1_A Software UART)
 	#define ADAFUIT_PRINTER_TX	&P2OUT,BIT0
 	#define ADAFUIT_PRINTER_RX	&P2OUT,BIT1
 
@@ -184,6 +300,77 @@
 
 #endif
 
+#ifdef HOST
+
+	// 7-Seg Module Pins Definition
+	#define DISPLAY7SEG_A 		hostPort1,BIT0
+	#define DISPLAY7SEG_B 		hostPort1,BIT1
+	#define DISPLAY7SEG_C 		hostPort1,BIT2
+	#define DISPLAY7SEG_D 		hostPort1,BIT3
+	#define DISPLAY7SEG_E 		hostPort1,BIT4
+	#define DISPLAY7SEG_F 		hostPort1,BIT5
+	#define DISPLAY7SEG_G 		hostPort1,BIT6
+	#define DISPLAY7SEG_POINT	hostPort1,BIT7
+
+	#define DISPLAY7SEG_COM1	hostPort2,BIT0
+	#define DISPLAY7SEG_COM2	hostPort2,BIT1
+	#define DISPLAY7SEG_COM3	hostPort2,BIT2
+	#define DISPLAY7SEG_COM4	hostPort2,BIT3
+	#define DISPLAY7SEG_COM5	hostPort2,BIT4
+	#define DISPLAY7SEG_COM6	hostPort2,BIT5
+
+	// LCD Module Pins Definition
+	#define LCD_RS				hostPort2,BIT0
+	#define LCD_E				hostPort2,BIT1
+	#define LCD_D4				hostPort2,BIT2
+	#define LCD_D5				hostPort2,BIT3
+	#define LCD_D6				hostPort2,BIT4
+	#define LCD_D7				hostPort2,BIT5
+
+	// GPS Module Pins Definition (SCI1 --> Standard Input / Output)
+	#define GPS_TX				hostPort1,BIT2
+	#define GPS_RX				hostPort1,BIT1
+	#define GPS_ON_OFF			hostPort2,BIT6
+	#define GPS_WAKE			hostPort2,BIT5
+
+	// Adafruit Printer Pins Definition
+	#define ADAFUIT_PRINTER_TX	hostPort2,BIT0
+	#define ADAFUIT_PRINTER_RX	hostPort2,BIT1
+
+#endif
+
+#ifdef HOST
+
+// POSIX without the glibc extensions, they define uint and ulong with the workstation widths
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE	200809L
+#endif
+
+#include <stdint.h>
+
+/**
+ * Type Definition Unsigned Integer, 16 bits as int on MSP430 and HCS08
+ * The host keeps the target widths so replay, tests and fuzzing overflow where the targets do
+ */
+typedef uint16_t uint;
+
+/**
+ * Type Definition Unsigned Char
+ */
+typedef unsigned char uchar;
+
+/**
+ * Type Definition Unsigned Long, 32 bits as long on MSP430 and HCS08
+ */
+typedef uint32_t ulong;
+
+/**
+ * Type Definition Signed Long, 32 bits as long on MSP430 and HCS08
+ */
+typedef int32_t slong;
+
+#else
+
 /**
  * Type Definition Unsigned Integer
  */
@@ -199,15 +386,23 @@ typedef unsigned char uchar;
  */
 typedef unsigned long ulong;
 
+/**
+ * Type Definition Signed Long
+ */
+typedef signed long slong;
+
+#endif
+
 /**
  * Type Definition Volatile Unsigned Char
  */
 typedef volatile unsigned char vuchar;
 
 /**
- * DCO Frequency Constant
+ * DCO Frequency Constant (1, 8, 12 or 16 MHz), MSP430 SMCLK and UART Clock
+ * The Software UART (SCI2) needs 8 MHz or more at 9600 bps, checked in hal/tim/uart.c
  */
-#define DCO_FREQ	1000000
+#define DCO_FREQ	16000000
 
 /**
  * CPU IDX Constant
@@ -52,6 +52,18 @@ void coreEnableInterrupts();
  */
 void coreDisableInterrupts();
 
+/**
+ * @brief Disable Interrupts and return the previous state, for critical sections that may run with interrupts disabled
+ * @return Interrupt State for coreRestoreInterrupts
+ */
+uchar coreSaveInterrupts();
+
+/**
+ * @brief Restore the Interrupt State returned by coreSaveInterrupts
+ * @param state Interrupt State
+ */
+void coreRestoreInterrupts(uchar state);
+
 /**
  * @brief Entry Low Power Mode
  */
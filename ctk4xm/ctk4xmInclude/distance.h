@@ -0,0 +1,162 @@
+/**
+ *  @file distance.h
+ *  @brief Module that calculates Distances between GPS Coordinates
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DISTANCE_H_
+#define DISTANCE_H_
+
+#include "config.h"
+#include "gps.h"
+
+/**
+ * Coordinate Units per Degree, Coordinates are 1e-7 Degrees (GPS_COORDINATE_SCALE)
+ */
+#define	DISTANCE_DEGREE			10000000UL
+
+/**
+ * Distance Scale, Distances are in Centimeters
+ */
+#define	DISTANCE_SCALE			100
+
+/**
+ * Distance not available, Vincenty did not converge (nearly antipodal points)
+ */
+#define	DISTANCE_INVALID		0xFFFFFFFFUL
+
+/**
+ * Maximum Magnitude after distanceScaleShift, products of two values fit in 29 bits and sums of two products in slong
+ */
+#define	DISTANCE_SCALED_MAX		0x3FFFUL
+
+/**
+ * @brief Sine of Angle, table with 1 Degree step and linear interpolation
+ * @param angle Angle 0 to 90 Degrees in 1e-7 Degrees
+ * @return Sine Q30 (1.0 --> 0x40000000), relative error below 4e-5
+ */
+ulong distanceSin(ulong angle);
+
+/**
+ * @brief Cosine of Angle
+ * @param angle Angle 0 to 90 Degrees in 1e-7 Degrees
+ * @return Cosine Q30 (1.0 --> 0x40000000)
+ */
+ulong distanceCos(ulong angle);
+
+/**
+ * @brief Arc Sine, inverse of distanceSin
+ * @param value Sine Q30, 0 to 0x40000000
+ * @return Angle 0 to 90 Degrees in 1e-7 Degrees
+ */
+ulong distanceAsin(ulong value);
+
+/**
+ * @brief Length of the vector (a, b) without overflow
+ * @param a First Component
+ * @param b Second Component
+ * @return sqrt(a * a + b * b), exact below 46341, relative error below 2e-6 above
+ */
+ulong distanceHypot(ulong a, ulong b);
+
+/**
+ * @brief Absolute Value
+ * @param value Value
+ * @return |value|, also for the most negative value
+ */
+ulong distanceAbs(slong value);
+
+/**
+ * @brief Right Shift that brings a Magnitude to DISTANCE_SCALED_MAX or below, for exact dot and cross products in slong
+ * @param magnitude Largest Magnitude of the values to scale, the OR of the magnitudes has the same shift
+ * @return Shift, 0 if the magnitude is already small enough
+ */
+uchar distanceScaleShift(ulong magnitude);
+
+/**
+ * @brief Scale Down a Signed Value by a Right Shift, rounded to zero for both signs
+ * @param value Value
+ * @param shift Shift from distanceScaleShift
+ * @return value / 2^shift
+ */
+slong distanceScaleDown(slong value, uchar shift);
+
+/**
+ * @brief Absolute Longitude Difference, wrapped at the 180 Degrees Meridian
+ * @param longitude1 Longitude First Point, 1e-7 Degrees
+ * @param longitude2 Longitude Second Point, 1e-7 Degrees
+ * @return Difference 0 to 180 Degrees in 1e-7 Degrees
+ */
+ulong distanceLongitudeDelta(slong longitude1, slong longitude2);
+
+/**
+ * @brief Equirectangular Distance on a Sphere (R = 6371008.8 m), cheapest, for short hops
+ * Error against the great circle below 7 cm up to 10 km, 7 m (0.01%) up to 100 km and 0.9% up to 1000 km,
+ * latitudes up to 70 Degrees, not usable farther (63% at 1000 to 10000 km), use distanceHaversine
+ * Sphere against WGS-84 ellipsoid adds up to 0.5%
+ * @param latitude1 Latitude First Point, 1e-7 Degrees
+ * @param longitude1 Longitude First Point, 1e-7 Degrees
+ * @param latitude2 Latitude Second Point, 1e-7 Degrees
+ * @param longitude2 Longitude Second Point, 1e-7 Degrees
+ * @return Distance in Centimeters
+ */
+ulong distanceEquirectangular(slong latitude1, slong longitude1, slong latitude2, slong longitude2);
+
+/**
+ * @brief East and North Offsets of a Point from an Origin, equirectangular projection at the origin latitude, for short hops
+ * Points projected from the same origin share one plane, for cross-track distances and bearings between them
+ * @param latitudeOrigin Latitude Origin, 1e-7 Degrees
+ * @param longitudeOrigin Longitude Origin, 1e-7 Degrees
+ * @param latitude Latitude Point, 1e-7 Degrees
+ * @param longitude Longitude Point, 1e-7 Degrees
+ * @param north North Offset in Centimeters, South negative
+ * @param east East Offset in Centimeters, West negative, wrapped at the 180 Degrees Meridian
+ */
+void distanceOffset(slong latitudeOrigin, slong longitudeOrigin, slong latitude, slong longitude, slong *north, slong *east);
+
+/**
+ * @brief Haversine Great Circle Distance on a Sphere (R = 6371008.8 m), any distance, integer table-driven trigonometry
+ * Error against the exact great circle below 15 cm + 0.0003%
+ * Sphere against WGS-84 ellipsoid adds up to 0.5%
+ * @param latitude1 Latitude First Point, 1e-7 Degrees
+ * @param longitude1 Longitude First Point, 1e-7 Degrees
+ * @param latitude2 Latitude Second Point, 1e-7 Degrees
+ * @param longitude2 Longitude Second Point, 1e-7 Degrees
+ * @return Distance in Centimeters
+ */
+ulong distanceHaversine(slong latitude1, slong longitude1, slong latitude2, slong longitude2);
+
+#ifdef GPS_FLOAT_API
+
+/**
+ * @brief Geodesic Distance on the WGS-84 Ellipsoid according to algorithm Thaddeus Vincenty, iterative, floating point
+ * Error below 1 mm with 64-bit double against GeographicLib reference lines (distanceBenchmark), use the
+ * fixed-point methods where double is 32-bit
+ * @param latitude1 Latitude First Point, 1e-7 Degrees
+ * @param longitude1 Longitude First Point, 1e-7 Degrees
+ * @param latitude2 Latitude Second Point, 1e-7 Degrees
+ * @param longitude2 Longitude Second Point, 1e-7 Degrees
+ * @return Distance in Centimeters, DISTANCE_INVALID if the iteration does not converge
+ */
+ulong distanceVincenty(slong latitude1, slong longitude1, slong latitude2, slong longitude2);
+
+#endif
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ *  @file geofence.h
+ *  @brief Module that detects Entering and Leaving of Geofences
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GEOFENCE_H_
+#define GEOFENCE_H_
+
+#include "config.h"
+#include "gps.h"
+#include "distance.h"
+
+/**
+ * Maximum Quantity Geofences, 1 bit of RAM each for the inside state
+ */
+#define	GEOFENCE_MAX_FENCES		64
+
+/**
+ * Geofence Types
+ */
+#define	GEOFENCE_CIRCLE			1
+#define	GEOFENCE_POLYGON		2
+
+/**
+ * Geofence Events
+ */
+#define	GEOFENCE_ENTER			1
+#define	GEOFENCE_EXIT			2
+
+/**
+ * Struct Geofence Point, 1e-7 Degrees, North and East positive
+ */
+typedef struct
+{
+	slong latitude;
+	slong longitude;
+} geofenceStructPoint;
+
+/**
+ * Struct Geofence, declare the table const so it is kept in Flash
+ * type --> GEOFENCE_CIRCLE or GEOFENCE_POLYGON
+ * boxMin, boxMax --> Bounding Box, must contain the whole fence, fences can not cross 180 Degrees of Longitude
+ * radius --> Circle Radius in Centimeters, not used by polygons
+ * points --> Circle Center (1 point) or Polygon Vertices, the last vertex is joined to the first one
+ * Polygon edges are resolved to the largest side of the box / 16384 (Ex. 9 cm for a 1 Km box)
+ * const geofenceStructPoint depot[] = {{47500000, -122300000}, {47500000, -122290000}, {47510000, -122290000}};
+ * const geofenceStructFence fences[] = {{GEOFENCE_POLYGON, {47500000, -122300000}, {47510000, -122290000}, 0, 3, depot}};
+ */
+typedef struct
+{
+	uchar type;
+	geofenceStructPoint boxMin;
+	geofenceStructPoint boxMax;
+	ulong radius;
+	uchar qtyPoints;
+	const geofenceStructPoint *points;
+} geofenceStructFence;
+
+/**
+ * @brief Geofence Init, all fences start outside
+ * @param fences Geofence Table
+ * @param qtyFences Quantity Geofences, up to GEOFENCE_MAX_FENCES
+ * @param callback Function called on each event with the fence index and GEOFENCE_ENTER or GEOFENCE_EXIT
+ */
+void geofenceInit(const geofenceStructFence *fences, uchar qtyFences, void (*callback)(uchar fence, uchar event));
+
+/**
+ * @brief Test the GPS Fix against all the Geofences, call from the main loop
+ * A fix already tested (same sequence) is ignored
+ * @param fix GPS Fix from gpsGetFix
+ * @return Quantity Events
+ */
+uchar geofenceUpdate(const gpsStructNmeaGPRMC *fix);
+
+/**
+ * @brief Get Geofence Inside State of the last fix tested
+ * @param fence Fence Index
+ * @return 1 --> Inside, 0 --> Outside
+ */
+uchar geofenceInside(uchar fence);
+
+/**
+ * @brief Test if a Point is inside a Geofence, bounding box first and then exact test
+ * @param fence Geofence
+ * @param latitude Latitude, 1e-7 Degrees
+ * @param longitude Longitude, 1e-7 Degrees
+ * @return 1 --> Inside, 0 --> Outside
+ */
+uchar geofenceContains(const geofenceStructFence *fence, slong latitude, slong longitude);
+
+#endif
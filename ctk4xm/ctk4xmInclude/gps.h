@@ -29,74 +29,342 @@
 #include "config.h"
 #include "delay.h"
 #include "io.h"
-#include "math.h"
 #include "uart.h"
+#include "calendar.h"
+
+#if (GPS_FIX_RATE < 1) || (GPS_FIX_RATE > 10)
+#error "GPS_FIX_RATE must be 1 to 10 Hz"
+#endif
+
+#if defined(GPS_SIRF_BINARY) && !defined(GPS_SIRF)
+#error "GPS_SIRF_BINARY needs GPS_SIRF"
+#endif
+
+/**
+ * GPS Wake Up Timeout in Milliseconds, GPS_WAKE must go high after the ON_OFF pulse
+ */
+#define	GPS_WAKE_TIMEOUT		1000
+
+/**
+ * GPS ON_OFF Pulse in Milliseconds
+ */
+#define	GPS_ON_OFF_PULSE		200
+
+/**
+ * NMEA Sentence Buffer Size, NMEA 0183 Sentence Max 82 Characters
+ */
+#define	GPS_NMEA_SENTENCE_SIZE	83
+
+#if GPS_NMEA_SENTENCE_SIZE > UART_LINE_SIZE
+#error "GPS_NMEA_SENTENCE_SIZE must fit in UART_LINE_SIZE, the sentence is stored in the GPS UART Line Pool"
+#endif
+
+/**
+ * NMEA Sentence Maximum Quantity Fields after the Sentence ID
+ */
+#define	GPS_NMEA_FIELD_QTY		20
+
+/**
+ * NMEA Sentence Types, any GP, GN, GL or GA Talker
+ */
+#define	GPS_NMEA_GGA			1
+#define	GPS_NMEA_GSA			2
+#define	GPS_NMEA_RMC			3
+#define	GPS_NMEA_GSV			4
+#define	GPS_NMEA_VTG			5
+#define	GPS_NMEA_ZDA			6
+
+/**
+ * Fixed-Point Latitude and Longitude Scale, 1e-7 Degrees
+ */
+#define	GPS_COORDINATE_SCALE	10000000L
+
+/**
+ * NMEA Coordinate Minute Scale, 5 Decimals of Minute are kept
+ */
+#define	GPS_COORDINATE_MINUTE_SCALE	100000UL
+
+/**
+ * Coordinate out of range, returned by gpsParseCoordinate for minutes above 59 or more than 180 Degrees
+ */
+#define	GPS_COORDINATE_INVALID	0x7FFFFFFFL
+
+/**
+ * Integer Digits of the NMEA Coordinate Fields, ddmm Latitude and dddmm Longitude
+ */
+#define	GPS_LATITUDE_DIGITS		4
+#define	GPS_LONGITUDE_DIGITS	5
+
+/**
+ * Maximum Decimals of gpsParseFixed, later digits are truncated
+ */
+#define	GPS_FIXED_MAX_DECIMALS	5
+
+/**
+ * Value of gpsParseFixed for a field that does not fit in 32 bits
+ */
+#define	GPS_FIXED_OVERFLOW		0xFFFFFFFFUL
+
+/**
+ * Fixed-Point Speed Over Ground Scale, 0.01 Knots
+ */
+#define	GPS_SPEED_SCALE			100
+
+/**
+ * Fixed-Point Course Scale, 0.01 Degrees
+ */
+#define	GPS_COURSE_SCALE		100
+
+/**
+ * Fixed-Point Altitude Scale, 0.01 Meters
+ */
+#define	GPS_ALTITUDE_SCALE		100
+
+/**
+ * Fixed-Point Dilution of Precision Scale, 0.01
+ */
+#define	GPS_DOP_SCALE			100
+
+/**
+ * Odometer Minimum Speed Over Ground (0.01 Knots), slower fixes are stationary jitter
+ */
+#define	GPS_ODOMETER_MIN_SPEED	50
+
+/**
+ * Odometer Maximum HDOP (0.01), fixes with worse HDOP are skipped
+ */
+#define	GPS_ODOMETER_MAX_HDOP	500
+
+/**
+ * Struct GGA and GSA NMEA Sentences, Fix Quality
+ * $GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47
+ * $GPGSA,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39
+ * fixQuality --> GGA 0 Invalid, 1 GPS, 2 DGPS, ..., 0 if no GGA for the fix epoch
+ * fixMode --> GSA 1 No Fix, 2 2D, 3 3D, 0 if no GSA received
+ * hdop, pdop --> 0.01, altitude --> 0.01 Meters above Mean Sea Level
+ */
+typedef struct
+{
+	uchar fixQuality;
+	uchar satellites;
+	uint hdop;
+	slong altitude;
+	uchar fixMode;
+	uint pdop;
+} gpsStructNmeaQuality;
 
 /**
  * Struct GPRMC NMEA Sentence
  * $GPRMC,181611.863,A,0000.0000,N,00000.0000,W,0.00,40.38,030813,,,A*47
+ * rtcHour, ..., rtcYear --> Local Time (GPS_TIME_ZONE or gpsSetTimeZone), rtcYear --> 2 digits of 20yy
+ * epoch --> UTC Unix Time, seconds since 01/01/1970, compare times with this field
+ * latitude, longitude --> 1e-7 Degrees, North and East positive
+ * speedOverGround --> 0.01 Knots, course --> 0.01 Degrees
+ * quality --> GGA of the same epoch and last GSA
+ * sequence --> Fix Sequence Number, incremented on each valid fix, 0 before the first fix
  */
 typedef struct
 {
 	uchar rtcHour;
 	uchar rtcMinute;
 	uchar rtcSecond;
-	uchar latitudeHour;
-	float latitudeMinuteSecond;
-	uchar latitudeNS;
-	uchar longitudeHour;
-	float longitudeMinuteSecond;
-	uchar longitudeEW;
-	float speedOverGround;
-	float course;
+	slong latitude;
+	slong longitude;
+	uint speedOverGround;
+	uint course;
 	uchar rtcDay;
 	uchar rtcMonth;
 	uchar rtcYear;
-	uchar isValid;
-	uchar wasRead;
+	ulong epoch;
+	gpsStructNmeaQuality quality;
+	ulong sequence;
 } gpsStructNmeaGPRMC;
 
+/**
+ * Struct GPS NMEA Statistics
+ * sentenceGood --> Checksum OK, sentenceChecksumError --> Checksum wrong or missing
+ * sentenceOverflow --> Sentence longer than GPS_NMEA_SENTENCE_SIZE or GPS_NMEA_FIELD_QTY fields
+ * sentenceIgnored --> Sentence ID not parsed (not GGA, GSA, RMC, GSV, VTG or ZDA) or malformed
+ * fixRejected --> RMC with status not 'A' or incomplete time and date, not published
+ */
+typedef struct
+{
+	uint sentenceGood;
+	uint sentenceChecksumError;
+	uint sentenceOverflow;
+	uint sentenceIgnored;
+	uint fixRejected;
+} gpsStructStats;
+
+/**
+ * @brief GPS Init, UART is set to Line Mode, the receiver is woken up and configured
+ * @param uart UART Handle connected to the GPS
+ */
+void gpsInit(uartStructHandle *uart);
+
+/**
+ * @brief GPS Wake Up from Hibernate, waits for GPS_WAKE up to GPS_WAKE_TIMEOUT
+ * @return 1 --> Awake, 0 --> GPS_WAKE did not go high
+ */
+uchar gpsWakeUp();
+
+/**
+ * @brief GPS Awake State
+ * @return 1 --> Full Power (GPS_WAKE high), 0 --> Hibernate
+ */
+uchar gpsAwake();
+
+/**
+ * @brief Toggle GPS between Hibernate and Full Power, GPS_ON_OFF pulse of GPS_ON_OFF_PULSE
+ */
+void gpsOnOffPulse();
+
+/**
+ * @brief Process Received NMEA Sentences, call from the main loop
+ */
+void gpsProcess();
 
 /**
- * @brief GPS Init
- * @parame uartID UART Id
+ * @brief Send Receiver Configuration (GPS_SIRF or GPS_MTK), polling the UART, called by gpsInit
+ * Turns off the unused NMEA Sentences, sets GPS_FIX_RATE and switches to binary with GPS_SIRF_BINARY
  */
-void gpsInit(uchar uartId);
+void gpsConfigure();
 
 /**
- * @brief Receive NMEA Sentence
+ * @brief Receive NMEA Sentence, only collects the characters and flags a complete sentence
+ * Safe to call from the UART RX ISR, the sentence is parsed by gpsProcess
+ * The sentence is stored in the first line of the GPS Line Pool, call it only if uartReceiveInterrupt does not read the GPS UART
  * @param GPS Character NMEA Sentence Receive
  */
 void gpsReceiveNMEASentence(uchar charReceive);
 
+/**
+ * @brief Receive SiRF Binary Byte, Geodetic Navigation Data (MID 41) is published as GPS Fix
+ * Called by gpsProcess with GPS_SIRF_BINARY, not from an ISR
+ * @param byteReceive Byte received from the GPS
+ */
+void gpsReceiveSirfByte(uchar byteReceive);
+
+/**
+ * @brief Receive Complete NMEA Sentence from UART Line Mode
+ * The fields are stored in place over the line, it must be kept until gpsProcess parses it
+ * @param line NMEA Sentence without delimiter
+ * @param length Quantity Characters
+ */
+void gpsReceiveNMEALine(uchar *line, uchar length);
+
+/**
+ * @brief Get GPS NMEA Statistics
+ * @param stats Copy of the GPS NMEA Statistics
+ */
+void gpsGetStats(gpsStructStats *stats);
+
+/**
+ * @brief Clear GPS NMEA Statistics
+ */
+void gpsClearStats();
+
+/**
+ * @brief Get NMEA Field of the last complete sentence
+ * @param fieldIndex Field Index, 0 is the first field after the Sentence ID
+ * @return Null terminated Field, empty if the sentence has less fields
+ */
+const uchar * gpsNmeaField(uchar fieldIndex);
+
+/**
+ * @brief Get NMEA Field Quantity Characters
+ * @param fieldIndex Field Index, 0 is the first field after the Sentence ID
+ * @return Quantity Characters
+ */
+uchar gpsNmeaFieldLength(uchar fieldIndex);
+
+/**
+ * @brief Get NMEA Sentence Quantity Fields
+ * @return Quantity Fields after the Sentence ID
+ */
+uchar gpsNmeaQtyFields();
+
+/**
+ * @brief Set Local Time Zone of the published fixes, GPS_TIME_ZONE after gpsInit
+ * @param timeZone Time Zone in 15 Minutes steps (Ex. UTC-5 --> -20, UTC+5:30 --> 22)
+ */
+void gpsSetTimeZone(signed char timeZone);
+
 /**
  * @brief Obtain and Parse NMEA GPRMC Sentence
- * @param utcTime UTC Time Zone
+ * @param timeZone Local Time Zone in 15 Minutes steps (Ex. UTC-5 --> -20, UTC+5:30 --> 22)
  * 0,1111111111,2,333333333,4,5555555555,6,7777,88888,999999,10
  * C,181611.863,A,0000.0000,N,00000.0000,W,0.00,40.38,030813,,,A*47
  */
-void gpsParseNmeaGPRMCSentence(uchar utcTimeZone);
+void gpsParseNmeaGPRMCSentence(signed char timeZone);
+
+/**
+ * @brief Obtain and Parse NMEA GPGGA Sentence, fix quality of the RMC epoch
+ */
+void gpsParseNmeaGPGGASentence();
+
+/**
+ * @brief Obtain and Parse NMEA GPGSA Sentence, used in the next published fix
+ */
+void gpsParseNmeaGPGSASentence();
+
+/**
+ * @brief Parse NMEA Decimal Field to Fixed-Point
+ * @param field NMEA Field, ends at the first character that is not a digit or the decimal point
+ * @param qtyDecimals Quantity Decimals kept, truncated or padded with zeros, up to GPS_FIXED_MAX_DECIMALS
+ * @return Field Value * 10^qtyDecimals, GPS_FIXED_OVERFLOW if it does not fit in 32 bits
+ */
+ulong gpsParseFixed(const uchar *field, uchar qtyDecimals);
+
+/**
+ * @brief Parse NMEA Coordinate Field to Fixed-Point Degrees
+ * @param field NMEA Latitude (ddmm.mmmmm) or Longitude (dddmm.mmmmm) Field
+ * @param hemisphere N, S, E or W
+ * @return Coordinate in 1e-7 Degrees, South and West negative, GPS_COORDINATE_INVALID if the minutes are 60 or more or above 180 Degrees
+ */
+slong gpsParseCoordinate(const uchar *field, uchar hemisphere);
+
+/**
+ * @brief Parse NMEA Signed Decimal Field to Fixed-Point
+ * @param field NMEA Field, optional '-' sign
+ * @param qtyDecimals Quantity Decimals kept, truncated or padded with zeros
+ * @return Field Value * 10^qtyDecimals
+ */
+slong gpsParseSignedFixed(const uchar *field, uchar qtyDecimals);
+
+#ifdef GPS_FLOAT_API
+
+/**
+ * @brief Convert Fixed-Point Value to Float
+ * @param value Fixed-Point Value
+ * @param scale Value Scale (Ex. GPS_COORDINATE_SCALE)
+ */
+float gpsFixedToFloat(slong value, slong scale);
 
 /**
- * @brief Obtain Float Value Variable
- * @param nmeaSentence NMEA Sentence
- * @param varPosition Position to convert
+ * @brief Obtain Float Value of NMEA Field
+ * @param fieldIndex Field Index, 0 is the first field after the Sentence ID
  */
-float gpsObtainFloatValue(uchar nmeaSentence, uchar varPosition);
+float gpsObtainFloatValue(uchar fieldIndex);
+
+#endif
+
 
+/**
+ * @brief Get Consistent Copy of the last GPS Fix, without disabling interrupts
+ * @param fix Copy of the GPS Fix, fix->sequence changes when a new fix is available
+ */
+void gpsGetFix(gpsStructNmeaGPRMC *fix);
 
 /**
- * Get NMEA RMC Struct
+ * @brief Get Trip Odometer, updated by gpsProcess on each published fix
+ * @return Distance in Millimeters since gpsInit or gpsResetOdometer, wraps after 4294 Km
  */
-gpsStructNmeaGPRMC * gpsNmeaGPRMCStruct();
+ulong gpsGetOdometer();
 
 /**
- * @brief Calculate the distance geodesic between two points according to algorithm Thaddeus Vincenty
- * @param latitude1 Latitude First Point
- * @param latitude1 Longitude First Point
- * @param latitude1 Latitude Second Point
- * @param latitude1 Longitude Second Point
+ * @brief Reset Trip Odometer, the next valid fix is the new start point
  */
-float gpsVincentyDistance(uint latitude1, uint longitude1, uint latitude2, uint longitude2);
+void gpsResetOdometer();
 
 #endif
@@ -0,0 +1,75 @@
+/**
+ *  @file gpsFilter.h
+ *  @brief Module that Smooths GPS Position and Velocity with a Fixed-Point Alpha-Beta Filter
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GPSFILTER_H_
+#define GPSFILTER_H_
+
+#include "config.h"
+#include "gps.h"
+
+// Gains and velocity are per fix of 1 Second, the fix epoch has no fraction to scale them at a higher rate
+#if defined(GPS_FILTER) && (GPS_FIX_RATE > 1)
+#error "GPS_FILTER needs GPS_FIX_RATE 1 Hz"
+#endif
+
+/**
+ * Maximum Time between Fixes in Seconds, a longer gap restarts the filter
+ */
+#define	GPS_FILTER_MAX_GAP		5
+
+/**
+ * Maximum Innovation in 1e-7 Degrees (about 1 Km), a larger jump restarts the filter
+ */
+#define	GPS_FILTER_MAX_JUMP		90000L
+
+/**
+ * Gains Table Size, HDOP steps of 0.5
+ */
+#define	GPS_FILTER_QTY_GAINS	16
+
+/**
+ * Full Turn of Longitude in 1e-7 Degrees, the filter wraps the longitude at the 180 Degrees Meridian
+ */
+#define	GPS_FILTER_FULL_TURN	(360UL * GPS_COORDINATE_SCALE)
+
+/**
+ * @brief Restart the Filter, the next fix is taken without smoothing
+ */
+void gpsFilterReset();
+
+/**
+ * @brief Filter the Position of the GPS Fix, called by gpsPublishFix with GPS_FILTER
+ * Steady-state Kalman gains (alpha-beta) from HDOP and speed, one step per fix, integer only
+ * @param fix GPS Fix, latitude and longitude are replaced by the filtered position
+ * @return 1 --> Filtered or restarted after a gap, 0 --> Restarted after a jump larger than GPS_FILTER_MAX_JUMP
+ */
+uchar gpsFilterUpdate(gpsStructNmeaGPRMC *fix);
+
+/**
+ * @brief Get Filtered Velocity
+ * @param latitudeRate North Velocity, 1e-7 Degrees per fix
+ * @param longitudeRate East Velocity, 1e-7 Degrees per fix
+ */
+void gpsFilterGetVelocity(slong *latitudeRate, slong *longitudeRate);
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ *  @file gpsPower.h
+ *  @brief Module that Duty-Cycles the GPS Receiver between Fixes
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GPSPOWER_H_
+#define GPSPOWER_H_
+
+#include "config.h"
+#include "gps.h"
+#include "timer.h"
+
+/**
+ * System Ticks from Seconds and Milliseconds, TIMER_TICK_US
+ */
+#define	GPS_POWER_SECONDS(seconds)	((ulong) (seconds) * (1000000UL / TIMER_TICK_US))
+#define	GPS_POWER_MS(ms)			((ulong) (ms) * 1000UL / TIMER_TICK_US + 1)
+
+/**
+ * Distance between Fixes in Meters, the interval follows the speed
+ */
+#define	GPS_POWER_DISTANCE			500
+
+/**
+ * Fix Interval Limits in Seconds, stationary vehicles use the maximum
+ * Ephemeris stay valid about 4 hours, a hot start needs hibernate below 2 hours
+ */
+#define	GPS_POWER_MIN_INTERVAL		10
+#define	GPS_POWER_MAX_INTERVAL		600
+
+/**
+ * Hot Start Time to First Fix in Seconds, the receiver is woken up this time before the next fix
+ */
+#define	GPS_POWER_HOT_START			3
+
+/**
+ * Fixes kept after Wake Up before the position is used, the navigation filter settles
+ */
+#define	GPS_POWER_SETTLE_FIXES		3
+
+/**
+ * Minimum Hibernate in Seconds, shorter intervals keep the receiver awake tracking every fix
+ * The two GPS_ON_OFF pulses and the hot start cost more than a few seconds of tracking
+ */
+#define	GPS_POWER_MIN_HIBERNATE		10
+
+/**
+ * Maximum time Awake without Fix in Seconds, then hibernate until the next interval
+ */
+#define	GPS_POWER_FIX_TIMEOUT		120
+
+/**
+ * Ephemeris Refresh, every period (Seconds) the receiver stays awake the refresh time (Seconds) after the fix
+ */
+#define	GPS_POWER_EPHEMERIS_PERIOD	3600
+#define	GPS_POWER_EPHEMERIS_TIME	30
+
+/**
+ * GPS Power States
+ */
+#define	GPS_POWER_HIBERNATE			0
+#define	GPS_POWER_WAKE_PULSE		1
+#define	GPS_POWER_WAKING			2
+#define	GPS_POWER_ACQUIRE			3
+#define	GPS_POWER_SLEEP_PULSE		4
+#define	GPS_POWER_SLEEPING			5
+
+/**
+ * Struct GPS Power Statistics
+ * wakeUps --> Wake Ups with GPS_WAKE confirmed, wakeTimeouts --> GPS_WAKE not changed after the pulse
+ * fixTimeouts --> Awake GPS_POWER_FIX_TIMEOUT without fix, awakeTicks --> System Ticks at full power
+ */
+typedef struct
+{
+	uint wakeUps;
+	uint wakeTimeouts;
+	uint fixTimeouts;
+	ulong awakeTicks;
+} gpsStructPowerStats;
+
+/**
+ * @brief GPS Power Init, call after gpsInit, the receiver stays awake until the first fix
+ */
+void gpsPowerInit();
+
+/**
+ * @brief GPS Power Scheduler, call from the main loop after gpsProcess, does not block
+ * Hibernates the receiver after GPS_POWER_SETTLE_FIXES and wakes it GPS_POWER_HOT_START before the next fix
+ */
+void gpsPowerProcess();
+
+/**
+ * @brief Get GPS Power State
+ * @return GPS_POWER_HIBERNATE, ..., GPS_POWER_SLEEPING
+ */
+uchar gpsPowerState();
+
+/**
+ * @brief Get Fix Interval from the last fix speed
+ * @return Seconds between Fixes
+ */
+uint gpsPowerInterval();
+
+/**
+ * @brief Get GPS Power Statistics
+ * @param stats Copy of the GPS Power Statistics
+ */
+void gpsPowerGetStats(gpsStructPowerStats *stats);
+
+#endif
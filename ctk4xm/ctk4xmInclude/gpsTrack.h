@@ -0,0 +1,96 @@
+/**
+ *  @file gpsTrack.h
+ *  @brief Module that Simplifies the GPS Track before Storage, Streaming Opening Window with Dead-Band
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GPSTRACK_H_
+#define GPSTRACK_H_
+
+#include "config.h"
+#include "gps.h"
+#include "distance.h"
+
+/**
+ * Window Size, fixes held until the next point is kept, 12 bytes of RAM each
+ * Also the largest ratio between fixes and points kept on a straight line (window + 1)
+ */
+#define	GPS_TRACK_WINDOW		16
+
+/**
+ * Struct GPS Track Point, 1e-7 Degrees, North and East positive
+ * epoch --> UTC Unix Time of the fix
+ */
+typedef struct
+{
+	slong latitude;
+	slong longitude;
+	ulong epoch;
+} gpsStructTrackPoint;
+
+/**
+ * Struct GPS Track Statistics
+ * fixes --> Fixes received, points --> Points kept (passed to the callback)
+ */
+typedef struct
+{
+	ulong fixes;
+	ulong points;
+} gpsStructTrackStats;
+
+/**
+ * @brief GPS Track Init, the next fix is kept as the start of the track
+ * @param tolerance Maximum distance in Centimeters from any fix to the simplified track (Ex. 1000 --> 10 m), twice for fixes dropped while stopped
+ * @param callback Function called with each point kept, store or upload it there
+ */
+void gpsTrackInit(ulong tolerance, void (*callback)(const gpsStructTrackPoint *point));
+
+/**
+ * @brief Add the GPS Fix to the Track, call from the main loop
+ * A fix already added (same sequence) is ignored, a fix within the tolerance of the last fix is dropped (stopped),
+ * it stays within twice the tolerance of the track
+ * @param fix GPS Fix from gpsGetFix
+ * @return Quantity Points kept
+ */
+uchar gpsTrackUpdate(const gpsStructNmeaGPRMC *fix);
+
+/**
+ * @brief Keep the last fix waiting in the window, call at the end of the trip or before powering off
+ * @return Quantity Points kept
+ */
+uchar gpsTrackFlush();
+
+/**
+ * @brief Distance from a Point to a Segment that starts at the origin, offsets from distanceOffset
+ * @param north North Offset of the Point in Centimeters
+ * @param east East Offset of the Point in Centimeters
+ * @param endNorth North Offset of the Segment End in Centimeters
+ * @param endEast East Offset of the Segment End in Centimeters
+ * @return Distance in Centimeters, resolved to the largest offset / 16384
+ */
+ulong gpsTrackDistance(slong north, slong east, slong endNorth, slong endEast);
+
+/**
+ * @brief Get GPS Track Statistics
+ * @param stats Copy of the GPS Track Statistics
+ */
+void gpsTrackGetStats(gpsStructTrackStats *stats);
+
+#endif
@@ -52,6 +52,18 @@ void _hal_coreEnableInterrupts();
  */
 void _hal_coreDisableInterrupts();
 
+/**
+ * @brief Disable Interrupts and return the previous state
+ * @return 1 --> Interrupts were enabled, 0 --> Disabled
+ */
+uchar _hal_coreSaveInterrupts();
+
+/**
+ * @brief Restore the Interrupt State returned by _hal_coreSaveInterrupts
+ * @param state Interrupt State
+ */
+void _hal_coreRestoreInterrupts(uchar state);
+
 /**
  * @brief Entry Low Power Mode
  */
@@ -51,4 +51,16 @@ void _hal_timerStart();
  */
 void _hal_timerStop();
 
+/**
+ * @brief Get Timer Counter
+ * @return Timer Counter, 0 to Period - 1
+ */
+uint _hal_timerGetCount();
+
+/**
+ * @brief Get Timer Period
+ * @return Timer Counts per Timer Interrupt
+ */
+uint _hal_timerGetPeriod();
+
 #endif
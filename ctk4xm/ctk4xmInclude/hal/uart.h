@@ -25,33 +25,88 @@
 #define UART_HAL_H_
 
 #include "config.h"
-#include "io.h"
+
+/**
+ * UART Receive Status, returned by _hal_uartReceiveData
+ */
+#define	UART_RX_DATA		0x01
+#define	UART_RX_OVERRUN		0x02
+#define	UART_RX_FRAMING		0x04
+#define	UART_RX_NOISE		0x08
+#define	UART_RX_PARITY		0x10
+#define	UART_RX_IDLE		0x20
+
+/**
+ * UART Receive Error Status
+ */
+#define	UART_RX_ERROR		(UART_RX_OVERRUN | UART_RX_FRAMING | UART_RX_NOISE | UART_RX_PARITY)
 
 /**
  * @brief Init UART Module
  * @param uartId UART Id
+ * @return UART Register Base, 0 if uartId is not valid
  */
-void _hal_uartInit(uchar uartId);
+vuchar * _hal_uartInit(uchar uartId);
 
 /**
  * @brief Read Byte UART
+ * @param uartRegister UART Register Base
  */
-uchar _hal_uartReadByte();
+uchar _hal_uartReadByte(vuchar *uartRegister);
+
+#ifdef HOST
+
+/**
+ * @brief Receive the bytes of a Buffer instead of Standard Input, for host replay programs
+ * @param uartId UART Id
+ * @param data Bytes to Receive, 0 --> back to Standard Input
+ * @param length Quantity Bytes, UART_RX_IDLE is returned after the last one
+ */
+void _hal_uartHostReplay(uchar uartId, const uchar *data, ulong length);
+
+#endif
+
+/**
+ * @brief Read Received Byte and Error Flags without blocking, clears the flags
+ * @param uartRegister UART Register Base
+ * @param readByte Received Byte
+ * @return Receive Status, UART_RX_DATA if readByte is valid
+ */
+uchar _hal_uartReceiveData(vuchar *uartRegister, uchar *readByte);
 
 /**
  * @brief Write Byte UART
+ * @param uartRegister UART Register Base
+ * @param writeByte Byte to Write
+ */
+void _hal_uartWriteByte(vuchar *uartRegister, uchar writeByte);
+
+/**
+ * @brief Test if the Transmitter can accept the next byte, called from TX ISR
+ * @param uartRegister UART Register Base
+ * @return 1 if the next byte can be written, 0 otherwise
+ */
+uchar _hal_uartTransmitReady(vuchar *uartRegister);
+
+/**
+ * @brief Write Byte to Transmit Data Register without blocking
+ * @param uartRegister UART Register Base
  * @param writeByte Byte to Write
  */
-void _hal_uartWriteByte(uchar writeByte);
+void _hal_uartTransmitData(vuchar *uartRegister, uchar writeByte);
 
 /**
  * @brief Read Interrupt Enable/Disable
+ * @param uartRegister UART Register Base
+ * @param state Enabled or Disabled
  */
-void _hal_uartReadInterrupt(uchar state);
+void _hal_uartReadInterrupt(vuchar *uartRegister, uchar state);
 
 /**
- * @brief Write Interrupt Enable/Disable
+ * @brief Write Interrupt (Transmit Data Register Empty) Enable/Disable
+ * @param uartRegister UART Register Base
+ * @param state Enabled or Disabled
  */
-void _hal_uartWriteInterrupt(uchar state);
+void _hal_uartWriteInterrupt(vuchar *uartRegister, uchar state);
 
 #endif
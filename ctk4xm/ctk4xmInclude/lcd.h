@@ -224,6 +224,14 @@ void lcdDataFloatFormatSetPosition(uchar row, uchar column, float dataExport, uc
  */
 void lcdDataFloatFormat(float dataExport, uchar quantityDigits, uchar quantityDecimals);
 
+/**
+ * @brief Send Data Fixed-Point Format LCD Module
+ * @param dataExport Data to Send to LCD Module, scaled by 10^quantityDecimals
+ * @param quantityDigits Quantity Digits
+ * @param quantityDecimals Quantity Decimals
+ */
+void lcdDataFixedFormat(ulong dataExport, uchar quantityDigits, uchar quantityDecimals);
+
 /**
  * @brief Send Data Date Format LCD Module
  * @param row LCD Row
@@ -0,0 +1,107 @@
+/**
+ *  @file navigation.h
+ *  @brief Module that Navigates a Waypoint List, Bearing and Distance to the Active Waypoint
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NAVIGATION_H_
+#define NAVIGATION_H_
+
+#include "config.h"
+#include "gps.h"
+#include "distance.h"
+
+/**
+ * Navigation States
+ */
+#define	NAVIGATION_IDLE			0
+#define	NAVIGATION_ACTIVE		1
+#define	NAVIGATION_FINISHED		2
+
+/**
+ * Struct Navigation Waypoint, 1e-7 Degrees, North and East positive
+ * Declare the table const so it is kept in Flash
+ * const navigationStructWaypoint route[] = {{47500000, -122300000}, {47510000, -122290000}};
+ */
+typedef struct
+{
+	slong latitude;
+	slong longitude;
+} navigationStructWaypoint;
+
+/**
+ * Struct Navigation Result, read by the display layer with navigationGetResult
+ * state --> NAVIGATION_IDLE (no fix yet), NAVIGATION_ACTIVE or NAVIGATION_FINISHED (last waypoint reached)
+ * waypoint --> Active Waypoint Index
+ * distance --> Distance to go in Centimeters
+ * bearing --> Bearing to the Waypoint, 0.01 Degrees clockwise from North (same as the fix course)
+ * turn --> Bearing - Course, 0.01 Degrees, negative to the left, 0 when stopped
+ * sequence --> Sequence of the GPS Fix used, refresh the display when it changes
+ */
+typedef struct
+{
+	uchar state;
+	uchar waypoint;
+	ulong distance;
+	uint bearing;
+	signed int turn;
+	ulong sequence;
+} navigationStructResult;
+
+/**
+ * @brief Navigation Init, the first waypoint is active
+ * @param waypoints Waypoint Table
+ * @param qtyWaypoints Quantity Waypoints
+ * @param arrivalRadius Distance in Centimeters to consider a waypoint reached (Ex. 2500 --> 25 m)
+ * @param callback Function called with the waypoint index when it is reached
+ */
+void navigationInit(const navigationStructWaypoint *waypoints, uchar qtyWaypoints, ulong arrivalRadius, void (*callback)(uchar waypoint));
+
+/**
+ * @brief Select the Active Waypoint (Ex. stop skipped by the driver), the result is updated on the next fix
+ * @param waypoint Waypoint Index, qtyWaypoints or more finishes the route
+ */
+void navigationSetWaypoint(uchar waypoint);
+
+/**
+ * @brief Navigate with the GPS Fix, call from the main loop
+ * A fix already used (same sequence) is ignored, reached waypoints advance to the next one
+ * Usually one measure per fix, waypoints closer than the arrival radius are passed in the same call,
+ * at most the waypoints left (qtyWaypoints - waypoint) measures
+ * @param fix GPS Fix from gpsGetFix
+ * @return Quantity Waypoints reached
+ */
+uchar navigationUpdate(const gpsStructNmeaGPRMC *fix);
+
+/**
+ * @brief Bearing of an Offset, table-driven atan2
+ * @param north North Offset
+ * @param east East Offset
+ * @return Bearing 0 to 35999 in 0.01 Degrees clockwise from North, error below 0.02 Degrees
+ */
+uint navigationBearing(slong north, slong east);
+
+/**
+ * @brief Get Navigation Result
+ * @param result Copy of the Navigation Result
+ */
+void navigationGetResult(navigationStructResult *result);
+
+#endif
@@ -51,4 +51,28 @@ void timerStart();
  */
 void timerStop();
 
+/**
+ * @brief Increment System Tick, called from Timer Interrupt
+ */
+void timerTickIncrement();
+
+/**
+ * @brief Get System Tick
+ * @return Timer Interrupts counted since reset
+ */
+ulong timerGetTick();
+
+/**
+ * @brief Get Timer Counter, measure short intervals inside a Tick
+ * @return Timer Counter
+ */
+uint timerGetCount();
+
+/**
+ * @brief Timer Counts elapsed since startCount, intervals shorter than one Tick
+ * @param startCount Timer Counter at the start of the interval
+ * @return Elapsed Timer Counts
+ */
+uint timerElapsed(uint startCount);
+
 #endif
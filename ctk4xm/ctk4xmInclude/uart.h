@@ -30,31 +30,231 @@
 #define	SCI1		1
 #define	SCI2		2
 
+#if (UART_QTY_PORTS < 1) || (UART_QTY_PORTS > 2)
+#error "UART_QTY_PORTS must be 1 or 2"
+#endif
+
+#if (UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) || (UART_RX_BUFFER_SIZE > 128)
+#error "UART_RX_BUFFER_SIZE must be a power of 2 not greater than 128"
+#endif
+
+#if (UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1)) || (UART_TX_BUFFER_SIZE > 128)
+#error "UART_TX_BUFFER_SIZE must be a power of 2 not greater than 128"
+#endif
+
+#if (UART_LINE_QTY & (UART_LINE_QTY - 1)) || (UART_LINE_QTY < 2)
+#error "UART_LINE_QTY must be a power of 2 not less than 2"
+#endif
+
+/**
+ * Struct UART Ring Buffer
+ * Single producer (RX ISR writes head) / single consumer (main loop writes tail)
+ */
+typedef struct
+{
+	uchar buffer[UART_RX_BUFFER_SIZE];
+	volatile uchar head;
+	volatile uchar tail;
+} uartStructRingBuffer;
+
+/**
+ * Struct UART Transmit Queue
+ * Single producer (main loop writes head) / single consumer (TX ISR writes tail)
+ */
+typedef struct
+{
+	uchar buffer[UART_TX_BUFFER_SIZE];
+	volatile uchar head;
+	volatile uchar tail;
+	void (*writeCompleteCallback)(void);
+} uartStructTxQueue;
+
+/**
+ * Struct UART Line Pool
+ * RX ISR fills line[head], lines from tail to head - 1 are completed
+ */
+typedef struct
+{
+	uchar line[UART_LINE_QTY][UART_LINE_SIZE];
+	uchar length[UART_LINE_QTY];
+	volatile uchar head;
+	volatile uchar tail;
+	uchar position;
+	uchar lineError;
+	uchar delimiterFirst;
+	uchar delimiterLast;
+} uartStructLinePool;
+
 /**
- * @brief Init UART Module
+ * Struct UART Statistics
+ * rxOverrun --> Receive Buffer full, rxErrorOverrun --> Receive Register not read in time
+ * rxLineError --> Lines discarded by an Overrun, Framing or Parity Error
+ * rxBufferPeak --> Receive Buffer maximum fill level
+ * rxIsrMaxCount --> RX ISR maximum duration in Timer Counts
+ */
+typedef struct
+{
+	uint rxBytes;
+	uint txBytes;
+	uint rxOverrun;
+	uint rxLineOverrun;
+	uint rxLineTooLong;
+	uint rxLineError;
+	uint rxErrorOverrun;
+	uint rxErrorFraming;
+	uint rxErrorNoise;
+	uint rxErrorParity;
+	uint rxIdle;
+	uchar rxBufferPeak;
+#ifdef UART_TIMESTAMP
+	ulong rxErrorTick;
+	ulong rxIdleTick;
+#endif
+#ifdef UART_ISR_PROFILE
+	uint rxIsrMaxCount;
+#endif
+} uartStructStats;
+
+/**
+ * Struct UART Handle
+ */
+typedef struct
+{
+	uchar uartId;
+	vuchar *registerBase;
+	uartStructRingBuffer rxBuffer;
+	uartStructTxQueue txQueue;
+	uartStructLinePool *linePool;
+	volatile uartStructStats stats;
+} uartStructHandle;
+
+/**
+ * @brief Open UART Port, configure pins, baud rate and buffers
  * @param uartId UART Id
+ * @return UART Handle, 0 if uartId is not valid
+ * SCI1 --> SCI1_BPS
+ * SCI2 --> SCI2_BPS
+ */
+uartStructHandle * uartOpen(uchar uartId);
+
+/**
+ * @brief Read Byte UART, polling the receiver
+ * @param uart UART Handle
+ */
+uchar uartReadByte(uartStructHandle *uart);
+
+/**
+ * @brief Read Bytes from UART Receive Buffer without blocking
+ * @param uart UART Handle
+ * @param buffer Destination Buffer
+ * @param maxLength Maximum Bytes to Read
+ * @return Quantity Bytes Read
+ */
+uchar uartRead(uartStructHandle *uart, uchar *buffer, uchar maxLength);
+
+/**
+ * @brief Quantity Bytes Available in UART Receive Buffer
+ * @param uart UART Handle
+ * @return Quantity Bytes Available
  */
-void uartInit(uchar uartId);
+uchar uartAvailable(uartStructHandle *uart);
 
 /**
- * @brief Read Byte UART
+ * @brief Select Line Mode, RX ISR stores complete lines in the Line Pool
+ * @param uart UART Handle
+ * @param linePool Line Pool, 0 to return to Ring Buffer Mode
+ * @param delimiter Line Delimiter, 1 or 2 characters (Ex. "\r\n"), not stored in the line
+ */
+void uartLineMode(uartStructHandle *uart, uartStructLinePool *linePool, const uchar *delimiter);
+
+/**
+ * @brief Get Oldest Completed Line without copy
+ * @param uart UART Handle
+ * @param length Quantity Characters in the Line
+ * @return Line Pointer (null terminated), 0 if there is no completed line
+ */
+uchar * uartReadLine(uartStructHandle *uart, uchar *length);
+
+/**
+ * @brief Release Line returned by uartReadLine to the RX ISR
+ * @param uart UART Handle
+ */
+void uartReleaseLine(uartStructHandle *uart);
+
+/**
+ * @brief Get UART Statistics
+ * @param uart UART Handle
+ * @param stats Copy of the UART Statistics
+ */
+void uartGetStats(uartStructHandle *uart, uartStructStats *stats);
+
+/**
+ * @brief Clear UART Statistics
+ * @param uart UART Handle
+ */
+void uartClearStats(uartStructHandle *uart);
+
+/**
+ * @brief UART Receive Interrupt Handler, store received byte in the Ring Buffer
+ * Count Receive Errors and Idle Line, also called from SCIx Error ISR
+ * @param uartId UART Id
  */
-uchar uartReadByte();
+void uartReceiveInterrupt(uchar uartId);
 
 /**
- * @brief Write Byte UART
+ * @brief Write Byte UART, polling the transmitter
+ * @param uart UART Handle
  * @param writeByte Byte to Write
  */
-void uartWriteByte(uchar writeByte);
+void uartWriteByte(uartStructHandle *uart, uchar writeByte);
+
+/**
+ * @brief Queue Bytes to Transmit without blocking
+ * @param uart UART Handle
+ * @param buffer Bytes to Transmit
+ * @param length Quantity Bytes to Transmit
+ * @return Quantity Bytes Queued
+ */
+uchar uartWriteBuffer(uartStructHandle *uart, const uchar *buffer, uchar length);
+
+/**
+ * @brief Free Space in UART Transmit Queue
+ * @param uart UART Handle
+ * @return Quantity Bytes that can be Queued
+ */
+uchar uartWriteFree(uartStructHandle *uart);
+
+/**
+ * @brief Wait until UART Transmit Queue is empty
+ * @param uart UART Handle
+ */
+void uartFlush(uartStructHandle *uart);
+
+/**
+ * @brief Set Function called from TX ISR when the Transmit Queue is drained
+ * @param uart UART Handle
+ * @param callback Write Complete Function, 0 to disable
+ */
+void uartWriteCompleteCallback(uartStructHandle *uart, void (*callback)(void));
+
+/**
+ * @brief UART Transmit Interrupt Handler, send next queued byte
+ * @param uartId UART Id
+ */
+void uartTransmitInterrupt(uchar uartId);
 
 /**
  * @brief Read Interrupt Enable/Disable
+ * @param uart UART Handle
+ * @param state Enabled or Disabled
  */
-void uartReadInterrupt(uchar state);
+void uartReadInterrupt(uartStructHandle *uart, uchar state);
 
 /**
- * @brief Write Interrupt Enable/Disable
+ * @brief Write Interrupt (Transmit Data Register Empty) Enable/Disable
+ * @param uart UART Handle
+ * @param state Enabled or Disabled
  */
-void uartWriteInterrupt(uchar state);
+void uartWriteInterrupt(uartStructHandle *uart, uchar state);
 
 #endif
@@ -31,6 +31,11 @@
 
 uchar column;
 
+/**
+ * Printer UART Handle
+ */
+uartStructHandle *adafruitPrinterUart;
+
 /**
  * Maximum Printing Dots
  */
@@ -58,9 +63,9 @@ uchar printerDensity;
 
 /**
  * @brief Adafruit Printer Init
- * @param uartId UART Id
+ * @param uart UART Handle connected to the Printer
  */
-void adafruitPrinterInit(uchar uartId)
+void adafruitPrinterInit(uartStructHandle *uart)
 {
 	// Init default value parameters
 	maxPrintingDots = 20;
@@ -72,8 +77,8 @@ void adafruitPrinterInit(uchar uartId)
 	// Initialize Counter Columns
 	column = 0;
 
-	// Configure UART2
-	uartInit(2);
+	// Printer UART
+	adafruitPrinterUart = uart;
 
 	// Delay 500 ms to Start
 	delayMs(500);
@@ -103,18 +108,17 @@ void adafruitPrinterWrite(uchar charPrint)
 		// Validate if character line feed or final line
 		if(charPrint == '\n' || column == MAX_COL)
 		{
-			// Send Line Feed Character
-			uartWriteByte('\n');
-			delayMs(1);
+			// Queue Line Feed Character, wait only if the queue is full
+			charPrint = '\n';
+			while(!uartWriteBuffer(adafruitPrinterUart, &charPrint, 1));
 
 			// Initialize column counter
 			column = 0;
 		}
 		else
 		{
-			// Send Character to Printer
-			uartWriteByte(charPrint);
-			delayMs(1);
+			// Queue Character to Printer, wait only if the queue is full
+			while(!uartWriteBuffer(adafruitPrinterUart, &charPrint, 1));
 
 			// Increment Column Counter
 			column++;
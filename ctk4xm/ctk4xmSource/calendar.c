@@ -0,0 +1,138 @@
+/**
+ *  @file calendar.c
+ *  @brief Module that converts Civil Dates, Time Zones and Unix Time
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "calendar.h"
+
+/**
+ * Days from 01/03/0000 to 01/01/1970
+ */
+#define	CALENDAR_EPOCH_DAYS		719468L
+
+/**
+ * Days per 400 Years Era
+ */
+#define	CALENDAR_ERA_DAYS		146097UL
+
+/**
+ * @brief Days from Civil Date, proleptic Gregorian calendar
+ * Years start in March so the leap day is the last day of the year
+ * @param year Full Year
+ * @param month Month 1 to 12
+ * @param day Day 1 to 31
+ * @return Days since 01/01/1970, negative before
+ */
+slong calendarDaysFromCivil(uint year, uchar month, uchar day)
+{
+	uint era;
+	uint yearOfEra;
+	uint dayOfYear;
+	ulong dayOfEra;
+
+	// January and February belong to the previous year
+	if(month <= 2)
+	{
+		year--;
+		month += 12;
+	}
+
+	era = year / 400;
+	yearOfEra = year - era * 400;
+
+	// Day of the year from 1st March, [0, 365]
+	dayOfYear = (153 * (month - 3) + 2) / 5 + day - 1;
+
+	// Day of the era, [0, 146096]
+	dayOfEra = (ulong) yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+	return (slong) (era * CALENDAR_ERA_DAYS + dayOfEra) - CALENDAR_EPOCH_DAYS;
+}
+
+/**
+ * @brief Civil Date from Days, inverse of calendarDaysFromCivil
+ * @param days Days since 01/01/1970, from 01/03/0000
+ * @param dateTime Year, Month and Day are written, time is not changed
+ */
+void calendarCivilFromDays(slong days, calendarStructDateTime *dateTime)
+{
+	ulong daysFromEra;
+	uint era;
+	ulong dayOfEra;
+	uint yearOfEra;
+	uint dayOfYear;
+	uchar monthFromMarch;
+
+	daysFromEra = (ulong) (days + CALENDAR_EPOCH_DAYS);
+	era = (uint) (daysFromEra / CALENDAR_ERA_DAYS);
+	dayOfEra = daysFromEra - era * CALENDAR_ERA_DAYS;
+
+	// Year of the era, [0, 399], removing the leap days of the 4, 100 and 400 years cycles
+	yearOfEra = (uint) ((dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365);
+	dayOfYear = (uint) (dayOfEra - ((ulong) yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100));
+
+	// Month from March [0, 11] and Day
+	monthFromMarch = (uchar) ((5 * dayOfYear + 2) / 153);
+	(*dateTime).day = (uchar) (dayOfYear - (153 * monthFromMarch + 2) / 5 + 1);
+	(*dateTime).month = monthFromMarch < 10 ? monthFromMarch + 3 : monthFromMarch - 9;
+	(*dateTime).year = yearOfEra + era * 400 + ((*dateTime).month <= 2);
+}
+
+/**
+ * @brief Unix Time from Civil Date and Time
+ * @param dateTime Date and Time, UTC
+ * @return Seconds since 01/01/1970 00:00:00 UTC, valid from 1970 to 2105
+ */
+ulong calendarToEpoch(const calendarStructDateTime *dateTime)
+{
+	ulong days;
+
+	days = (ulong) calendarDaysFromCivil((*dateTime).year, (*dateTime).month, (*dateTime).day);
+
+	return days * CALENDAR_DAY_SECONDS + (ulong) (*dateTime).hour * 3600 + (uint) (*dateTime).minute * 60 + (*dateTime).second;
+}
+
+/**
+ * @brief Civil Date and Time from Unix Time
+ * @param epoch Seconds since 01/01/1970 00:00:00
+ * @param timeZone Time Zone in 15 Minutes steps added to the epoch (Ex. UTC-5 --> -20, UTC+5:30 --> 22)
+ * @param dateTime Local Date and Time
+ */
+void calendarFromEpoch(ulong epoch, signed char timeZone, calendarStructDateTime *dateTime)
+{
+	ulong days;
+	ulong secondOfDay;
+	uint minuteOfDay;
+
+	// Time Zone, negative zones before the epoch wrap around and are not supported
+	epoch += (ulong) ((slong) timeZone * CALENDAR_ZONE_SECONDS);
+
+	days = epoch / CALENDAR_DAY_SECONDS;
+	secondOfDay = epoch - days * CALENDAR_DAY_SECONDS;
+
+	// Seconds of the day, 16-bit from here
+	minuteOfDay = (uint) (secondOfDay / 60);
+	(*dateTime).second = (uchar) (secondOfDay - (ulong) minuteOfDay * 60);
+	(*dateTime).hour = (uchar) (minuteOfDay / 60);
+	(*dateTime).minute = (uchar) (minuteOfDay - (*dateTime).hour * 60);
+
+	calendarCivilFromDays((slong) days, dateTime);
+}
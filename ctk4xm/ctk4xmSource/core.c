@@ -65,6 +65,24 @@ void coreDisableInterrupts()
 	_hal_coreDisableInterrupts();
 }
 
+/**
+ * @brief Disable Interrupts and return the previous state, for critical sections that may run with interrupts disabled
+ * @return Interrupt State for coreRestoreInterrupts
+ */
+uchar coreSaveInterrupts()
+{
+	return _hal_coreSaveInterrupts();
+}
+
+/**
+ * @brief Restore the Interrupt State returned by coreSaveInterrupts
+ * @param state Interrupt State
+ */
+void coreRestoreInterrupts(uchar state)
+{
+	_hal_coreRestoreInterrupts(state);
+}
+
 /**
  * @brief Entry Low Power Mode
  */
@@ -66,6 +66,11 @@
  */
 #include "gps.h"
 
+/**
+ * GPS Power Include
+ */
+#include "gpsPower.h"
+
 /**
  * EEPROM Include
  */
@@ -79,6 +84,9 @@
 #ifdef TIM
 	#define LED		&P1OUT,BIT0
 	#define LED2	&P1OUT,BIT1
+#elif defined(HOST)
+	#define LED		hostPort1,BIT0
+	#define LED2	hostPort1,BIT1
 #else
 	#define LED		&PTCD,BIT0
 	#define LED2	&PTCD,BIT1
@@ -91,7 +99,9 @@ void application()
 {
 	volatile uchar writeState;
 	volatile uchar data;
-	gpsStructNmeaGPRMC *structNmeaGPRMC;
+	gpsStructNmeaGPRMC gpsFix;
+	ulong gpsFixDisplayed;
+	slong coordinate;
 
 	// Stop Watchdog Timer
 	coreStopWatchdogTimer();
@@ -99,8 +109,13 @@ void application()
 	// Select Internal Clock 8MHz
 	//coreSelectInternalClock(8);
 
+#ifdef TIM
+	// Select Calibrated DCO, UART Baud Rate is derived from DCO_FREQ
+	coreSelectInternalClock(DCO_FREQ / 1000000);
+#else
 	// Select External Clock
 	coreSelectExternalClock();
+#endif
 
 	// Configure LED Pin
 	ioDigitalOutput(LED);
@@ -110,7 +125,7 @@ void application()
 	eepromInit(20);
 
 	// GPS Init
-	gpsInit(SCI1);
+	gpsInit(uartOpen(SCI1));
 
 	// Init LCD Module
 	display7SegInit();
@@ -136,45 +151,68 @@ void application()
 	// Export data to LCD
 	lcdWriteSetPosition(2, 1, data);*/
 	
+	// No GPS Fix Displayed
+	gpsFixDisplayed = 0;
+
 	// Enable MCU Interrupts
 	coreEnableInterrupts();
+
+#ifdef GPS_POWER
+	// GPS Power Scheduler, needs the System Tick started by display7SegInit
+	gpsPowerInit();
+#endif
 	
 	while(1)
 	{
-		// Get NMEA GPRMC
-		structNmeaGPRMC = gpsNmeaGPRMCStruct();
+#ifdef HOST
+		// No Interrupts on the host, poll the UART RX ISR (Standard Input)
+		uartReceiveInterrupt(SCI1);
+#endif
 
-		if((*structNmeaGPRMC).isValid == 'Y' & (*structNmeaGPRMC).wasRead == 'N')
+		// Parse GPS Sentences Received by UART ISR
+		gpsProcess();
+
+#ifdef GPS_POWER
+		// Hibernate and Wake Up the GPS between fixes
+		gpsPowerProcess();
+#endif
+
+		// Get GPS Fix
+		gpsGetFix(&gpsFix);
+
+		// Display only new fixes
+		if(gpsFix.sequence != gpsFixDisplayed)
 		{
+			gpsFixDisplayed = gpsFix.sequence;
+
 			ioDigitalWrite(LED2, 1);
 
 			// Export data to LCD
 			lcdSetCursor(2,1);
-			lcdDataDecFormat((*structNmeaGPRMC).rtcHour, 2);
+			lcdDataDecFormat(gpsFix.rtcHour, 2);
 			lcdWrite(':');
-			lcdDataDecFormat((*structNmeaGPRMC).rtcMinute, 2);
+			lcdDataDecFormat(gpsFix.rtcMinute, 2);
 			lcdWrite(':');
-			lcdDataDecFormat((*structNmeaGPRMC).rtcSecond, 2);
-			lcdDataDecFormat((*structNmeaGPRMC).rtcDay, 2);
+			lcdDataDecFormat(gpsFix.rtcSecond, 2);
+			lcdDataDecFormat(gpsFix.rtcDay, 2);
 			lcdWrite('/');
-			lcdDataDecFormat((*structNmeaGPRMC).rtcMonth, 2);
+			lcdDataDecFormat(gpsFix.rtcMonth, 2);
 			lcdWrite('/');
-			lcdDataDecFormat((*structNmeaGPRMC).rtcYear, 2);
+			lcdDataDecFormat(gpsFix.rtcYear, 2);
 
+			// Latitude and Longitude in Degrees, 4 Decimals
 			lcdSetCursor(1,1);
-			lcdDataDecFormat((*structNmeaGPRMC).latitudeHour, 2);
-			lcdDataFloatFormat((*structNmeaGPRMC).latitudeMinuteSecond, 2, 4);
-			lcdDataDecFormat((*structNmeaGPRMC).longitudeHour, 2);
-			lcdDataFloatFormat((*structNmeaGPRMC).longitudeMinuteSecond, 2, 4);
+			coordinate = gpsFix.latitude;
+			lcdDataFixedFormat((coordinate < 0 ? -coordinate : coordinate) / 1000, 2, 4);
+			lcdWrite(coordinate < 0 ? 'S' : 'N');
+			coordinate = gpsFix.longitude;
+			lcdDataFixedFormat((coordinate < 0 ? -coordinate : coordinate) / 1000, 3, 4);
+			lcdWrite(coordinate < 0 ? 'W' : 'E');
 
 			// Export data to Display 7-Seg
-			display7SegWriteDecFormat(1, (*structNmeaGPRMC).rtcHour, 2);
-			display7SegWriteDecFormat(3, (*structNmeaGPRMC).rtcMinute, 2);
-			display7SegWriteDecFormat(5, (*structNmeaGPRMC).rtcSecond, 2);
-
-			// Finally set was read
-			(*structNmeaGPRMC).isValid = 'N';
-			(*structNmeaGPRMC).wasRead = 'Y';
+			display7SegWriteDecFormat(1, gpsFix.rtcHour, 2);
+			display7SegWriteDecFormat(3, gpsFix.rtcMinute, 2);
+			display7SegWriteDecFormat(5, gpsFix.rtcSecond, 2);
 
 			ioDigitalWrite(LED2, 0);
 		}
@@ -212,7 +250,8 @@ void isrAdc10()
  */
 void isrSci0Tx()
 {
-
+	// Send Next Queued Byte
+	uartTransmitInterrupt(SCI1);
 }
 
 /**
@@ -220,7 +259,8 @@ void isrSci0Tx()
  */
 void isrSci0Rx()
 {
-
+	// Store Received Byte
+	uartReceiveInterrupt(SCI1);
 }
 
 /**
@@ -228,7 +268,11 @@ void isrSci0Rx()
  */
 void isrTimer0Ch1()
 {
+	// System Tick
+	timerTickIncrement();
 
+	// Clear Interrupt Flag
+	timerClearInterruptFlag();
 }
 
 /**
@@ -260,7 +304,10 @@ void isrComparatorA()
  */
 void isrTimer1Ch1()
 {
-
+#if UART_QTY_PORTS >= SCI2
+	// Software UART Receive Bit
+	uartReceiveInterrupt(SCI2);
+#endif
 }
 
 /**
@@ -268,7 +315,10 @@ void isrTimer1Ch1()
  */
 void isrTimer1Ch0()
 {
-
+#if UART_QTY_PORTS >= SCI2
+	// Software UART Transmit Bit
+	uartTransmitInterrupt(SCI2);
+#endif
 }
 
 /**
@@ -289,7 +339,8 @@ void isrNMI()
  */
 void isrSCI2_TX()
 {
-
+	// Send Next Queued Byte
+	uartTransmitInterrupt(SCI2);
 }
 
 /**
@@ -297,7 +348,8 @@ void isrSCI2_TX()
  */
 void isrSCI2_RX()
 {
-
+	// Store Received Byte
+	uartReceiveInterrupt(SCI2);
 }
 
 /**
@@ -305,7 +357,8 @@ void isrSCI2_RX()
  */
 void isrSCI2_ERR()
 {
-
+	// Count Error and clear Flags
+	uartReceiveInterrupt(SCI2);
 }
 
 /**
@@ -313,7 +366,8 @@ void isrSCI2_ERR()
  */
 void isrSCI1_TX()
 {
-
+	// Send Next Queued Byte
+	uartTransmitInterrupt(SCI1);
 }
 
 /**
@@ -321,8 +375,8 @@ void isrSCI1_TX()
  */
 void isrSCI1_RX()
 {
-	// Process GPS NMEA Sentence
-	gpsReceiveNMEASentence(uartReadByte());
+	// Store Received Byte, GPS NMEA Sentence is processed in the main loop
+	uartReceiveInterrupt(SCI1);
 }
 
 /**
@@ -330,7 +384,8 @@ void isrSCI1_RX()
  */
 void isrSCI1_ERR()
 {
-	SCI1S1 = 0;
+	// Count Error and clear Flags
+	uartReceiveInterrupt(SCI1);
 }
 
 /**
@@ -341,6 +396,9 @@ void isrTPM1_OVER()
 	// Display 7-Seg Update
 	display7SegUpdate();
 
+	// System Tick
+	timerTickIncrement();
+
 	// Clear Interrupt Flag
 	timerClearInterruptFlag();
 }
@@ -113,8 +113,8 @@ void display7SegInit()
 	// Display Buffer Clear
 	display7SegBufferClear();
 
-	// Set Count 2000 Cycles at 1us = 2ms
-	timerSetCount(2000);
+	// Set Count 2000 Cycles at 1us = 2ms, System Tick
+	timerSetCount(TIMER_TICK_US);
 
 	// Enable Timer Interrupt
 	timerInterruptEnable();
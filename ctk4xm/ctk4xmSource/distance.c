@@ -0,0 +1,646 @@
+/**
+ *  @file distance.c
+ *  @brief Module that calculates Distances between GPS Coordinates
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "distance.h"
+
+#ifdef GPS_FLOAT_API
+#include "math.h"
+#endif
+
+/**
+ * Sine Q30 from 0 to 90 Degrees, 1 Degree step
+ */
+const ulong distanceSinTable[91] =
+{
+	0UL, 18739379UL, 37473049UL, 56195305UL, 74900443UL, 93582766UL,
+	112236583UL, 130856211UL, 149435979UL, 167970228UL, 186453311UL, 204879599UL,
+	223243478UL, 241539355UL, 259761657UL, 277904834UL, 295963357UL, 313931728UL,
+	331804471UL, 349576144UL, 367241333UL, 384794656UL, 402230767UL, 419544355UL,
+	436730145UL, 453782903UL, 470697435UL, 487468587UL, 504091252UL, 520560366UL,
+	536870912UL, 553017922UL, 568996477UL, 584801711UL, 600428808UL, 615873009UL,
+	631129609UL, 646193961UL, 661061475UL, 675727625UL, 690187940UL, 704438018UL,
+	718473518UL, 732290163UL, 745883746UL, 759250125UL, 772385229UL, 785285058UL,
+	797945680UL, 810363241UL, 822533958UL, 834454122UL, 846120104UL, 857528349UL,
+	868675383UL, 879557810UL, 890172315UL, 900515665UL, 910584710UL, 920376381UL,
+	929887697UL, 939115760UL, 948057759UL, 956710970UL, 965072759UL, 973140576UL,
+	980911966UL, 988384560UL, 995556083UL, 1002424350UL, 1008987269UL, 1015242840UL,
+	1021189159UL, 1026824413UL, 1032146887UL, 1037154959UL, 1041847103UL, 1046221891UL,
+	1050277989UL, 1054014162UL, 1057429273UL, 1060522280UL, 1063292242UL, 1065738315UL,
+	1067859754UL, 1069655912UL, 1071126243UL, 1072270298UL, 1073087729UL, 1073578288UL,
+	1073741824UL
+};
+
+/**
+ * 0.1119508 in Q32, Centimeters per 1e-7 Degree of great circle is 1.1119508
+ */
+#define	DISTANCE_CM_FRACTION	480825035UL
+
+/**
+ * 0.4967296 in Q32, 1 / 1e7 in Q32 is 429.4967296
+ */
+#define	DISTANCE_DEGREE_FRACTION	2133437387UL
+
+/**
+ * h^2 / 2 and h^3 / 6 in Q32 with h = 1 Degree in Radians, error terms of the linear interpolation
+ */
+#define	DISTANCE_INTERPOLATION_H2	654161UL
+#define	DISTANCE_INTERPOLATION_H3	3806UL
+
+/**
+ * 1e-7 Degrees per Radian
+ */
+#define	DISTANCE_RADIAN			572957795UL
+
+/**
+ * Sine Q30 of 90 Degrees
+ */
+#define	DISTANCE_Q30_ONE		0x40000000UL
+
+/**
+ * @brief Multiply and keep the high 32 bits, multiply by a Q32 Fraction
+ * @param a First Value
+ * @param b Second Value or Fraction Q32
+ * @return (a * b) >> 32, up to 2 LSB below
+ */
+ulong distanceMulHigh(ulong a, ulong b)
+{
+	ulong aHigh;
+	ulong aLow;
+	ulong bHigh;
+	ulong bLow;
+
+	aHigh = a >> 16;
+	aLow = a & 0xFFFF;
+	bHigh = b >> 16;
+	bLow = b & 0xFFFF;
+
+	// Low * Low term is below 1 LSB
+	return (aHigh * bHigh) + ((aHigh * bLow) >> 16) + ((aLow * bHigh) >> 16);
+}
+
+/**
+ * @brief Multiply two Q30 values up to 1.0
+ * @param a First Value Q30
+ * @param b Second Value Q30
+ * @return a * b in Q30
+ */
+ulong distanceMulQ30(ulong a, ulong b)
+{
+	return distanceMulHigh(a << 1, b << 1);
+}
+
+/**
+ * @brief Divide to a Fraction, binary long division
+ * @param numerator Numerator, lower than denominator
+ * @param denominator Denominator
+ * @return numerator / denominator in Q32
+ */
+ulong distanceFraction(ulong numerator, ulong denominator)
+{
+	ulong fraction;
+	uchar carry;
+	uchar i;
+
+	fraction = 0;
+
+	for(i = 0; i < 32; i++)
+	{
+		// Remainder is lower than denominator, shifted out bit means greater
+		carry = (numerator & 0x80000000UL) != 0;
+		numerator <<= 1;
+		fraction <<= 1;
+
+		if(carry || numerator >= denominator)
+		{
+			numerator -= denominator;
+			fraction |= 1;
+		}
+	}
+
+	return fraction;
+}
+
+/**
+ * @brief Integer Square Root
+ * @param value Value
+ * @return floor(sqrt(value))
+ */
+ulong distanceSqrt(ulong value)
+{
+	ulong root;
+	ulong bit;
+
+	root = 0;
+	bit = 0x40000000UL;
+
+	while(bit > value)
+	{
+		bit >>= 2;
+	}
+
+	while(bit)
+	{
+		if(value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+/**
+ * @brief Absolute Difference of two Coordinates
+ * @param coordinate1 First Coordinate
+ * @param coordinate2 Second Coordinate
+ * @return |coordinate2 - coordinate1|, up to 360 Degrees without overflow
+ */
+ulong distanceDelta(slong coordinate1, slong coordinate2)
+{
+	if(coordinate2 >= coordinate1)
+	{
+		return (ulong) coordinate2 - (ulong) coordinate1;
+	}
+
+	return (ulong) coordinate1 - (ulong) coordinate2;
+}
+
+/**
+ * @brief Sine of Angle, table with 1 Degree step and linear interpolation
+ * @param angle Angle 0 to 90 Degrees in 1e-7 Degrees
+ * @return Sine Q30 (1.0 --> 0x40000000), relative error below 4e-5
+ */
+ulong distanceSin(ulong angle)
+{
+	uchar index;
+	ulong remainder;
+	ulong fraction;
+	ulong sine;
+	ulong product;
+
+	index = (uchar) (angle / DISTANCE_DEGREE);
+
+	if(index >= 90)
+	{
+		return DISTANCE_Q30_ONE;
+	}
+
+	// Position between table entries in Q32, remainder / 1e7
+	remainder = angle - index * DISTANCE_DEGREE;
+	fraction = remainder * 429 + distanceMulHigh(remainder, DISTANCE_DEGREE_FRACTION);
+
+	// Linear Interpolation
+	sine = distanceSinTable[index] + distanceMulHigh(distanceSinTable[index + 1] - distanceSinTable[index], fraction);
+
+	// Linear Interpolation is low by t * (1 - t) * (sin(x0) * h^2 / 2 + cos(x0) * (1 + t) * h^3 / 6)
+	product = distanceMulHigh(fraction, 0xFFFFFFFFUL - fraction);
+	sine += distanceMulHigh(distanceSinTable[index], distanceMulHigh(product, DISTANCE_INTERPOLATION_H2));
+	sine += distanceMulHigh(distanceSinTable[90 - index], distanceMulHigh(product + distanceMulHigh(product, fraction), DISTANCE_INTERPOLATION_H3));
+
+	return sine;
+}
+
+/**
+ * @brief Cosine of Angle
+ * @param angle Angle 0 to 90 Degrees in 1e-7 Degrees
+ * @return Cosine Q30 (1.0 --> 0x40000000)
+ */
+ulong distanceCos(ulong angle)
+{
+	if(angle >= 90 * DISTANCE_DEGREE)
+	{
+		return 0;
+	}
+
+	return distanceSin(90 * DISTANCE_DEGREE - angle);
+}
+
+/**
+ * @brief Arc Sine, inverse of distanceSin
+ * @param value Sine Q30, 0 to 0x40000000
+ * @return Angle 0 to 90 Degrees in 1e-7 Degrees, error grows above 45 Degrees, use the complementary angle there
+ */
+ulong distanceAsin(ulong value)
+{
+	uchar low;
+	uchar high;
+	uchar middle;
+	ulong angle;
+	ulong sine;
+	ulong cosine;
+	ulong correction;
+
+	if(value >= DISTANCE_Q30_ONE)
+	{
+		return 90 * DISTANCE_DEGREE;
+	}
+
+	// Binary Search of the Degree, distanceSinTable[low] <= value < distanceSinTable[low + 1]
+	low = 0;
+	high = 90;
+
+	while(high - low > 1)
+	{
+		middle = (low + high) >> 1;
+
+		if(distanceSinTable[middle] <= value)
+		{
+			low = middle;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	// Linear Interpolation
+	angle = low * DISTANCE_DEGREE + distanceMulHigh(DISTANCE_DEGREE, distanceFraction(value - distanceSinTable[low], distanceSinTable[low + 1] - distanceSinTable[low]));
+
+	// One Newton Step, angle += (value - sin(angle)) / cos(angle)
+	sine = distanceSin(angle);
+	cosine = distanceCos(angle);
+
+	if(sine < value && value - sine < cosine)
+	{
+		correction = distanceMulHigh(distanceFraction(value - sine, cosine), DISTANCE_RADIAN);
+		angle += correction;
+	}
+	else if(sine > value && sine - value < cosine)
+	{
+		correction = distanceMulHigh(distanceFraction(sine - value, cosine), DISTANCE_RADIAN);
+		angle -= correction;
+	}
+
+	if(angle > 90 * DISTANCE_DEGREE)
+	{
+		angle = 90 * DISTANCE_DEGREE;
+	}
+
+	return angle;
+}
+
+/**
+ * @brief Length of the vector (a, b) without overflow
+ * @param a First Component
+ * @param b Second Component
+ * @return sqrt(a * a + b * b), exact below 46341, relative error below 2e-6 above
+ */
+ulong distanceHypot(ulong a, ulong b)
+{
+	ulong estimate;
+	ulong high;
+	ulong low;
+	uchar shift;
+
+	// Order a >= b
+	if(b > a)
+	{
+		estimate = a;
+		a = b;
+		b = estimate;
+	}
+
+	// First Estimate, keep both squares and their sum in 32 bits
+	high = a;
+	low = b;
+	shift = 0;
+
+	while(high > 46340)
+	{
+		high >>= 1;
+		low >>= 1;
+		shift++;
+	}
+
+	estimate = distanceSqrt(high * high + low * low) << shift;
+
+	if(shift == 0 || b == 0)
+	{
+		return estimate;
+	}
+
+	// Refine with h = a + b * b / (a + h), halves keep a + h in 32 bits
+	estimate = a + distanceMulHigh(b, distanceFraction(b >> 1, (a >> 1) + (estimate >> 1)));
+	estimate = a + distanceMulHigh(b, distanceFraction(b >> 1, (a >> 1) + (estimate >> 1)));
+
+	return estimate;
+}
+
+/**
+ * @brief Absolute Value
+ * @param value Value
+ * @return |value|, also for the most negative value
+ */
+ulong distanceAbs(slong value)
+{
+	return distanceDelta(0, value);
+}
+
+/**
+ * @brief Right Shift that brings a Magnitude to DISTANCE_SCALED_MAX or below, for exact dot and cross products in slong
+ * @param magnitude Largest Magnitude of the values to scale, the OR of the magnitudes has the same shift
+ * @return Shift, 0 if the magnitude is already small enough
+ */
+uchar distanceScaleShift(ulong magnitude)
+{
+	uchar shift;
+
+	shift = 0;
+
+	// One bit per step, variable shifts are loops on the targets
+	while(magnitude > DISTANCE_SCALED_MAX)
+	{
+		magnitude >>= 1;
+		shift++;
+	}
+
+	return shift;
+}
+
+/**
+ * @brief Scale Down a Signed Value by a Right Shift, rounded to zero for both signs
+ * @param value Value
+ * @param shift Shift from distanceScaleShift
+ * @return value / 2^shift
+ */
+slong distanceScaleDown(slong value, uchar shift)
+{
+	if(value < 0)
+	{
+		return (slong) (0 - (distanceAbs(value) >> shift));
+	}
+
+	return (slong) ((ulong) value >> shift);
+}
+
+/**
+ * @brief Absolute Longitude Difference, wrapped at the 180 Degrees Meridian
+ * @param longitude1 Longitude First Point, 1e-7 Degrees
+ * @param longitude2 Longitude Second Point, 1e-7 Degrees
+ * @return Difference 0 to 180 Degrees in 1e-7 Degrees
+ */
+ulong distanceLongitudeDelta(slong longitude1, slong longitude2)
+{
+	ulong delta;
+
+	delta = distanceDelta(longitude1, longitude2);
+
+	if(delta > 180 * DISTANCE_DEGREE)
+	{
+		delta = 360 * DISTANCE_DEGREE - delta;
+	}
+
+	return delta;
+}
+
+/**
+ * @brief Convert Great Circle Angle to Distance
+ * @param angle Angle in 1e-7 Degrees, up to 180 Degrees
+ * @return Distance in Centimeters
+ */
+ulong distanceAngleToCm(ulong angle)
+{
+	return angle + distanceMulHigh(angle, DISTANCE_CM_FRACTION);
+}
+
+/**
+ * @brief Equirectangular Distance on a Sphere (R = 6371008.8 m), cheapest, for short hops
+ * Error against the great circle below 7 cm up to 10 km, 7 m (0.01%) up to 100 km and 0.9% up to 1000 km,
+ * latitudes up to 70 Degrees, not usable farther (63% at 1000 to 10000 km), use distanceHaversine
+ * Sphere against WGS-84 ellipsoid adds up to 0.5%
+ * @param latitude1 Latitude First Point, 1e-7 Degrees
+ * @param longitude1 Longitude First Point, 1e-7 Degrees
+ * @param latitude2 Latitude Second Point, 1e-7 Degrees
+ * @param longitude2 Longitude Second Point, 1e-7 Degrees
+ * @return Distance in Centimeters
+ */
+ulong distanceEquirectangular(slong latitude1, slong longitude1, slong latitude2, slong longitude2)
+{
+	ulong cosLatitude;
+	ulong x;
+	ulong y;
+
+	// Cosine of the mean latitude in Q32
+	cosLatitude = distanceCos(distanceAbs((latitude1 + latitude2) / 2));
+
+	if(cosLatitude >= DISTANCE_Q30_ONE)
+	{
+		cosLatitude = 0xFFFFFFFFUL;
+	}
+	else
+	{
+		cosLatitude <<= 2;
+	}
+
+	// East and North Components in 1e-7 Degrees of great circle
+	x = distanceMulHigh(distanceLongitudeDelta(longitude1, longitude2), cosLatitude);
+	y = distanceDelta(latitude1, latitude2);
+
+	return distanceAngleToCm(distanceHypot(x, y));
+}
+
+/**
+ * @brief East and North Offsets of a Point from an Origin, equirectangular projection at the origin latitude, for short hops
+ * Points projected from the same origin share one plane, for cross-track distances and bearings between them
+ * @param latitudeOrigin Latitude Origin, 1e-7 Degrees
+ * @param longitudeOrigin Longitude Origin, 1e-7 Degrees
+ * @param latitude Latitude Point, 1e-7 Degrees
+ * @param longitude Longitude Point, 1e-7 Degrees
+ * @param north North Offset in Centimeters, South negative
+ * @param east East Offset in Centimeters, West negative, wrapped at the 180 Degrees Meridian
+ */
+void distanceOffset(slong latitudeOrigin, slong longitudeOrigin, slong latitude, slong longitude, slong *north, slong *east)
+{
+	ulong cosLatitude;
+	ulong x;
+	ulong y;
+
+	// Cosine of the origin latitude in Q32
+	cosLatitude = distanceCos(distanceAbs(latitudeOrigin));
+
+	if(cosLatitude >= DISTANCE_Q30_ONE)
+	{
+		cosLatitude = 0xFFFFFFFFUL;
+	}
+	else
+	{
+		cosLatitude <<= 2;
+	}
+
+	// Magnitudes in Centimeters, up to half the great circle (2e9) fit in slong
+	x = distanceAngleToCm(distanceMulHigh(distanceLongitudeDelta(longitudeOrigin, longitude), cosLatitude));
+	y = distanceAngleToCm(distanceDelta(latitudeOrigin, latitude));
+
+	*north = latitude >= latitudeOrigin ? (slong) y : -(slong) y;
+
+	// East when the short way round goes up in longitude
+	if((longitude >= longitudeOrigin) == (distanceDelta(longitudeOrigin, longitude) <= 180 * DISTANCE_DEGREE))
+	{
+		*east = (slong) x;
+	}
+	else
+	{
+		*east = -(slong) x;
+	}
+}
+
+/**
+ * @brief Haversine Great Circle Distance on a Sphere (R = 6371008.8 m), any distance, integer table-driven trigonometry
+ * Error against the exact great circle below 15 cm + 0.0003%
+ * Sphere against WGS-84 ellipsoid adds up to 0.5%
+ * @param latitude1 Latitude First Point, 1e-7 Degrees
+ * @param longitude1 Longitude First Point, 1e-7 Degrees
+ * @param latitude2 Latitude Second Point, 1e-7 Degrees
+ * @param longitude2 Longitude Second Point, 1e-7 Degrees
+ * @return Distance in Centimeters
+ */
+ulong distanceHaversine(slong latitude1, slong longitude1, slong latitude2, slong longitude2)
+{
+	ulong halfDeltaLatitude;
+	ulong halfDeltaLongitude;
+	ulong meanLatitude;
+	ulong sinLongitude;
+	ulong cosLongitude;
+	ulong sinHalfAngle;
+	ulong cosHalfAngle;
+
+	halfDeltaLatitude = distanceDelta(latitude1, latitude2) / 2;
+	halfDeltaLongitude = distanceLongitudeDelta(longitude1, longitude2) / 2;
+	meanLatitude = distanceAbs((latitude1 + latitude2) / 2);
+
+	sinLongitude = distanceSin(halfDeltaLongitude);
+	cosLongitude = distanceCos(halfDeltaLongitude);
+
+	// sin(c / 2) = sqrt(haversine) = hypot(sin(dLat / 2) * cos(dLon / 2), cos(meanLat) * sin(dLon / 2))
+	// Same value as sqrt(sin^2(dLat / 2) + cos(lat1) * cos(lat2) * sin^2(dLon / 2)) without the small squares
+	sinHalfAngle = distanceHypot(distanceMulQ30(distanceSin(halfDeltaLatitude), cosLongitude), distanceMulQ30(distanceCos(meanLatitude), sinLongitude));
+
+	// cos(c / 2) = sqrt(1 - haversine) = hypot(cos(dLat / 2) * cos(dLon / 2), sin(meanLat) * sin(dLon / 2))
+	cosHalfAngle = distanceHypot(distanceMulQ30(distanceCos(halfDeltaLatitude), cosLongitude), distanceMulQ30(distanceSin(meanLatitude), sinLongitude));
+
+	// Central Angle c, Arc Sine of the smaller one keeps the half angle below 45 Degrees
+	if(sinHalfAngle <= cosHalfAngle)
+	{
+		return distanceAngleToCm(2 * distanceAsin(sinHalfAngle));
+	}
+
+	return distanceAngleToCm(2 * (90 * DISTANCE_DEGREE - distanceAsin(cosHalfAngle)));
+}
+
+#ifdef GPS_FLOAT_API
+
+/**
+ * @brief Geodesic Distance on the WGS-84 Ellipsoid according to algorithm Thaddeus Vincenty, iterative, floating point
+ *        Adapted Original Version Javascript (C) Chris Veness 2002 - 2012
+ *        http://www.movable-type.co.uk/scripts/latlong-vincenty.html
+ * Error below 1 mm with 64-bit double against GeographicLib reference lines (distanceBenchmark), use the
+ * fixed-point methods where double is 32-bit
+ * @param latitude1 Latitude First Point, 1e-7 Degrees
+ * @param longitude1 Longitude First Point, 1e-7 Degrees
+ * @param latitude2 Latitude Second Point, 1e-7 Degrees
+ * @param longitude2 Longitude Second Point, 1e-7 Degrees
+ * @return Distance in Centimeters, DISTANCE_INVALID if the iteration does not converge
+ */
+ulong distanceVincenty(slong latitude1, slong longitude1, slong latitude2, slong longitude2)
+{
+	// WGS-84 Ellipsoid
+	const double a = 6378137.0;
+	const double b = 6356752.314245;
+	const double f = 1 / 298.257223563;
+	const double toRadians = 3.14159265358979323846 / 180.0 / DISTANCE_DEGREE;
+
+	double L, U1, U2, sinU1, cosU1, sinU2, cosU2;
+	double lambda, lambdaP, sinLambda, cosLambda;
+	double sinSigma, cosSigma, sigma, sinAlpha, cosSqAlpha, cos2SigmaM, C;
+	double uSq, A, B, deltaSigma;
+	uchar iterLimit;
+
+	// Longitude Difference in -180 to 180 Degrees
+	L = (double) distanceLongitudeDelta(longitude1, longitude2) * toRadians;
+	U1 = atan((1 - f) * tan((double) latitude1 * toRadians));
+	U2 = atan((1 - f) * tan((double) latitude2 * toRadians));
+
+	sinU1 = sin(U1);
+	cosU1 = cos(U1);
+	sinU2 = sin(U2);
+	cosU2 = cos(U2);
+
+	lambda = L;
+	iterLimit = 100;
+
+	do
+	{
+		sinLambda = sin(lambda);
+		cosLambda = cos(lambda);
+		sinSigma = sqrt((cosU2 * sinLambda) * (cosU2 * sinLambda) + (cosU1 * sinU2 - sinU1 * cosU2 * cosLambda) * (cosU1 * sinU2 - sinU1 * cosU2 * cosLambda));
+
+		// Co-incident Points
+		if(sinSigma == 0)
+		{
+			return 0;
+		}
+
+		cosSigma = sinU1 * sinU2 + cosU1 * cosU2 * cosLambda;
+		sigma = atan2(sinSigma, cosSigma);
+		sinAlpha = cosU1 * cosU2 * sinLambda / sinSigma;
+		cosSqAlpha = 1 - sinAlpha * sinAlpha;
+
+		// Equatorial Line, cosSqAlpha = 0
+		if(cosSqAlpha != 0)
+		{
+			cos2SigmaM = cosSigma - 2 * sinU1 * sinU2 / cosSqAlpha;
+		}
+		else
+		{
+			cos2SigmaM = 0;
+		}
+
+		C = f / 16 * cosSqAlpha * (4 + f * (4 - 3 * cosSqAlpha));
+		lambdaP = lambda;
+		lambda = L + (1 - C) * f * sinAlpha * (sigma + C * sinSigma * (cos2SigmaM + C * cosSigma * (-1 + 2 * cos2SigmaM * cos2SigmaM)));
+	}
+	while(fabs(lambda - lambdaP) > 1e-12 && --iterLimit > 0);
+
+	// Formula failed to converge
+	if(iterLimit == 0)
+	{
+		return DISTANCE_INVALID;
+	}
+
+	uSq = cosSqAlpha * (a * a - b * b) / (b * b);
+	A = 1 + uSq / 16384 * (4096 + uSq * (-768 + uSq * (320 - 175 * uSq)));
+	B = uSq / 1024 * (256 + uSq * (-128 + uSq * (74 - 47 * uSq)));
+	deltaSigma = B * sinSigma * (cos2SigmaM + B / 4 * (cosSigma * (-1 + 2 * cos2SigmaM * cos2SigmaM) - B / 6 * cos2SigmaM * (-3 + 4 * sinSigma * sinSigma) * (-3 + 4 * cos2SigmaM * cos2SigmaM)));
+
+	// Meters to Centimeters, rounded
+	return (ulong) (b * A * (sigma - deltaSigma) * DISTANCE_SCALE + 0.5);
+}
+
+#endif
@@ -0,0 +1,233 @@
+/**
+ *  @file geofence.c
+ *  @brief Module that detects Entering and Leaving of Geofences
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "geofence.h"
+
+/**
+ * Geofence Table
+ */
+const geofenceStructFence *geofenceFences;
+
+/**
+ * Geofence Quantity
+ */
+uchar geofenceQtyFences;
+
+/**
+ * Geofence Event Callback
+ */
+void (*geofenceCallback)(uchar fence, uchar event);
+
+/**
+ * Geofence Inside State, 1 bit per fence
+ */
+uchar geofenceInsideState[(GEOFENCE_MAX_FENCES + 7) / 8];
+
+/**
+ * Sequence of the last GPS Fix tested
+ */
+ulong geofenceSequence;
+
+/**
+ * @brief Geofence Init, all fences start outside
+ * @param fences Geofence Table
+ * @param qtyFences Quantity Geofences, up to GEOFENCE_MAX_FENCES
+ * @param callback Function called on each event with the fence index and GEOFENCE_ENTER or GEOFENCE_EXIT
+ */
+void geofenceInit(const geofenceStructFence *fences, uchar qtyFences, void (*callback)(uchar fence, uchar event))
+{
+	uchar i;
+
+	if(qtyFences > GEOFENCE_MAX_FENCES)
+	{
+		qtyFences = GEOFENCE_MAX_FENCES;
+	}
+
+	geofenceFences = fences;
+	geofenceQtyFences = qtyFences;
+	geofenceCallback = callback;
+
+	for(i = 0; i < sizeof(geofenceInsideState); i++)
+	{
+		geofenceInsideState[i] = 0;
+	}
+
+	// Sequence 0 is never published
+	geofenceSequence = 0;
+}
+
+/**
+ * @brief Test if a Point inside the Bounding Box is inside the Polygon, crossing number
+ * Coordinates are taken relative to the box and scaled down so the cross products fit in 32 bits
+ * @param fence Polygon Geofence
+ * @param latitude Latitude, 1e-7 Degrees
+ * @param longitude Longitude, 1e-7 Degrees
+ * @return 1 --> Inside, 0 --> Outside
+ */
+uchar geofenceInsidePolygon(const geofenceStructFence *fence, slong latitude, slong longitude)
+{
+	const geofenceStructPoint *points;
+	ulong span;
+	ulong spanLongitude;
+	uchar shift;
+	uchar inside;
+	uchar i;
+	uchar j;
+	slong x;
+	slong y;
+	slong xi;
+	slong yi;
+	slong xj;
+	slong yj;
+	slong cross;
+
+	points = (*fence).points;
+
+	// Scale for the largest side of the box
+	span = (ulong) (*fence).boxMax.latitude - (ulong) (*fence).boxMin.latitude;
+	spanLongitude = (ulong) (*fence).boxMax.longitude - (ulong) (*fence).boxMin.longitude;
+
+	if(spanLongitude > span)
+	{
+		span = spanLongitude;
+	}
+
+	shift = distanceScaleShift(span);
+
+	// Point relative to the box
+	x = (slong) (((ulong) longitude - (ulong) (*fence).boxMin.longitude) >> shift);
+	y = (slong) (((ulong) latitude - (ulong) (*fence).boxMin.latitude) >> shift);
+
+	inside = 0;
+	j = (*fence).qtyPoints - 1;
+
+	for(i = 0; i < (*fence).qtyPoints; i++)
+	{
+		xi = (slong) (((ulong) points[i].longitude - (ulong) (*fence).boxMin.longitude) >> shift);
+		yi = (slong) (((ulong) points[i].latitude - (ulong) (*fence).boxMin.latitude) >> shift);
+		xj = (slong) (((ulong) points[j].longitude - (ulong) (*fence).boxMin.longitude) >> shift);
+		yj = (slong) (((ulong) points[j].latitude - (ulong) (*fence).boxMin.latitude) >> shift);
+
+		// Edge crosses the horizontal line of the point
+		if((yi > y) != (yj > y))
+		{
+			// Point is left of the crossing, x < xi + (y - yi) * (xj - xi) / (yj - yi) without division
+			cross = (xj - xi) * (y - yi) - (x - xi) * (yj - yi);
+
+			if(yj > yi ? cross > 0 : cross < 0)
+			{
+				inside ^= 1;
+			}
+		}
+
+		j = i;
+	}
+
+	return inside;
+}
+
+/**
+ * @brief Test if a Point is inside a Geofence, bounding box first and then exact test
+ * @param fence Geofence
+ * @param latitude Latitude, 1e-7 Degrees
+ * @param longitude Longitude, 1e-7 Degrees
+ * @return 1 --> Inside, 0 --> Outside
+ */
+uchar geofenceContains(const geofenceStructFence *fence, slong latitude, slong longitude)
+{
+	// Bounding Box, rejects most fences with 4 comparisons
+	if(latitude < (*fence).boxMin.latitude || latitude > (*fence).boxMax.latitude || longitude < (*fence).boxMin.longitude || longitude > (*fence).boxMax.longitude)
+	{
+		return 0;
+	}
+
+	if((*fence).type == GEOFENCE_CIRCLE)
+	{
+		return distanceEquirectangular((*fence).points[0].latitude, (*fence).points[0].longitude, latitude, longitude) <= (*fence).radius;
+	}
+
+	if((*fence).type == GEOFENCE_POLYGON && (*fence).qtyPoints >= 3)
+	{
+		return geofenceInsidePolygon(fence, latitude, longitude);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Test the GPS Fix against all the Geofences, call from the main loop
+ * A fix already tested (same sequence) is ignored
+ * @param fix GPS Fix from gpsGetFix
+ * @return Quantity Events
+ */
+uchar geofenceUpdate(const gpsStructNmeaGPRMC *fix)
+{
+	uchar fence;
+	uchar mask;
+	uchar inside;
+	uchar qtyEvents;
+
+	// No fix yet or fix already tested
+	if((*fix).sequence == geofenceSequence)
+	{
+		return 0;
+	}
+
+	geofenceSequence = (*fix).sequence;
+	qtyEvents = 0;
+
+	for(fence = 0; fence < geofenceQtyFences; fence++)
+	{
+		mask = 1 << (fence & 0x07);
+		inside = geofenceContains(&geofenceFences[fence], (*fix).latitude, (*fix).longitude);
+
+		// State changed
+		if(inside != ((geofenceInsideState[fence >> 3] & mask) != 0))
+		{
+			geofenceInsideState[fence >> 3] ^= mask;
+			qtyEvents++;
+
+			if(geofenceCallback)
+			{
+				geofenceCallback(fence, inside ? GEOFENCE_ENTER : GEOFENCE_EXIT);
+			}
+		}
+	}
+
+	return qtyEvents;
+}
+
+/**
+ * @brief Get Geofence Inside State of the last fix tested
+ * @param fence Fence Index
+ * @return 1 --> Inside, 0 --> Outside
+ */
+uchar geofenceInside(uchar fence)
+{
+	if(fence >= geofenceQtyFences)
+	{
+		return 0;
+	}
+
+	return (geofenceInsideState[fence >> 3] >> (fence & 0x07)) & 0x01;
+}
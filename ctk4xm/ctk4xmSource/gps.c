@@ -25,59 +25,92 @@
  * GPS Include
  */
 #include "gps.h"
+#include "core.h"
+#include "distance.h"
+#include "gpsFilter.h"
 
 /**
- * NMEA Sentence Buffer
- * [0] $GPGGA
- * [1] $GPGSA
- * [2] $GPRMC
+ * NMEA Sentence Buffer, fields after the Sentence ID, each one null terminated
+ * The UART line parsed in place (gpsReceiveNMEALine), or the first line of gpsLinePool (gpsReceiveNMEASentence)
  */
-uchar gpsNmeaSentenceBuffer[3][15][15];
+uchar *gpsNmeaSentenceBuffer;
 
 /**
- * NMEA Sentence Pointer
+ * NMEA Sentence Buffer Quantity Characters
  */
-uchar *ptrNmeaSentenceBuffer;
+uchar gpsNmeaSentenceLength;
 
 /**
- * Capture NMEA Sentence Flag
+ * NMEA Field Start Offsets in gpsNmeaSentenceBuffer
  */
-uchar gpsCaptureNMEASentence;
+uchar gpsNmeaFieldOffset[GPS_NMEA_FIELD_QTY];
 
 /**
- * Buffer ID NMEA Sentence
+ * NMEA Sentence Quantity Fields
  */
-uchar gpsNmeaSentenceIdBuffer [6];
+uchar gpsNmeaFieldQty;
 
 /**
- * ID NMEA Sentence $GPGGA
+ * Capture NMEA Sentence Flag
  */
-const uchar gpsNmeaSentenceGPGGAId [] = "$GPGGA";
+uchar gpsCaptureNMEASentence;
 
 /**
- * ID NMEA Sentence $GPGGA Counter
+ * NMEA Sentence ID Trie Terminal Node, Sentence Type in the low bits
  */
-uchar gpsNmeaSentenceGPGGAIdCounter;
+#define	GPS_NMEA_ID(type)		(0x80 | (type))
 
 /**
- * ID NMEA Sentence $GPGGA
+ * NMEA Sentence ID Trie Quantity Character Classes
  */
-const uchar gpsNmeaSentenceGPGSAId [] = "$GPGSA";
+#define	GPS_NMEA_ID_CLASSES		14
 
 /**
- * ID NMEA Sentence $GPGGA Counter
+ * NMEA Sentence ID Character Class of 'A' to 'Z', 0 --> Not used in any ID
+ * 1 A, 2 C, 3 D, 4 G, 5 L, 6 M, 7 N, 8 P, 9 R, 10 S, 11 T, 12 V, 13 Z
  */
-uchar gpsNmeaSentenceGPGSAIdCounter;
+const uchar gpsNmeaIdClass[26] =
+{
+	1, 0, 2, 3, 0, 0, 4, 0, 0, 0, 0, 5, 6, 7, 0, 8, 0, 9, 10, 11, 0, 12, 0, 0, 0, 13
+};
 
 /**
- * ID NMEA Sentence GPRMC
+ * NMEA Sentence ID Trie, [State - 1][Character Class] --> Next State
+ * 0 --> Sentence not wanted, GPS_NMEA_ID(type) --> Sentence ID complete
+ * Talkers GP, GN, GL, GA --> Types RMC, GGA, GSA, GSV, VTG, ZDA
  */
-const uchar gpsNmeaSentenceGPRMCId [] = "$GPRMC";
+const uchar gpsNmeaIdTrie[][GPS_NMEA_ID_CLASSES] =
+{
+	//  1 Start --> G
+	{0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	//  2 Talker G --> P, N, L, A
+	{0, 3, 0, 0, 0, 3, 0, 3, 3, 0, 0, 0, 0, 0},
+	//  3 Type --> R, G, V, Z
+	{0, 0, 0, 0, 6, 0, 0, 0, 0, 4, 0, 0, 9, 11},
+	//  4 R --> M
+	{0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0},
+	//  5 RM --> C
+	{0, 0, GPS_NMEA_ID(GPS_NMEA_RMC), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	//  6 G --> G, S
+	{0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 8, 0, 0, 0},
+	//  7 GG --> A
+	{0, GPS_NMEA_ID(GPS_NMEA_GGA), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	//  8 GS --> A, V
+	{0, GPS_NMEA_ID(GPS_NMEA_GSA), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, GPS_NMEA_ID(GPS_NMEA_GSV), 0},
+	//  9 V --> T
+	{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0},
+	// 10 VT --> G
+	{0, 0, 0, 0, GPS_NMEA_ID(GPS_NMEA_VTG), 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	// 11 Z --> D
+	{0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	// 12 ZD --> A
+	{0, GPS_NMEA_ID(GPS_NMEA_ZDA), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
+};
 
 /**
- * ID NMEA Sentence GPRMC Counter
+ * NMEA Sentence ID Trie State, 0 --> Sentence not wanted
  */
-uchar gpsNmeaSentenceGPRMCIdCounter;
+uchar gpsNmeaIdState;
 
 /**
  * Quantity Chars Receive
@@ -85,24 +118,262 @@ uchar gpsNmeaSentenceGPRMCIdCounter;
 uchar gpsQtyCharsReceive;
 
 /**
- * Struct NMEA GPRMC
+ * NMEA Checksum, XOR of the characters between '$' and '*'
+ */
+uchar gpsNmeaChecksum;
+
+/**
+ * NMEA Checksum State
+ * 0 --> Before '*', 1 --> First Digit, 2 --> Second Digit, 3 --> Checksum OK
+ */
+uchar gpsNmeaChecksumState;
+
+/**
+ * GPS NMEA Statistics
+ */
+volatile gpsStructStats gpsStats;
+
+/**
+ * NMEA Sentence Type being captured (GPS_NMEA_RMC, ...)
+ */
+uchar gpsNmeaSentenceType;
+
+/**
+ * GPS Fix Double Buffer, parser writes the buffer not published by gpsFixIndex
+ */
+gpsStructNmeaGPRMC gpsFixBuffer[2];
+
+/**
+ * Published GPS Fix Buffer Index
+ */
+volatile uchar gpsFixIndex;
+
+/**
+ * Published GPS Fix Sequence Number
+ */
+volatile ulong gpsFixSequence;
+
+/**
+ * GPS Epoch Sentences received
+ */
+#define	GPS_EPOCH_RMC			0x01
+#define	GPS_EPOCH_GGA			0x02
+
+/**
+ * GPS Epoch UTC Time (hhmmss.ss * 100) of the buffer not published
+ */
+ulong gpsEpochTime;
+
+/**
+ * GPS Epoch Sentences received for gpsEpochTime (GPS_EPOCH_RMC, GPS_EPOCH_GGA)
+ */
+uchar gpsEpochSentences;
+
+/**
+ * Last GSA Fix Mode, GSA has no time and is used in the next published fix
+ */
+uchar gpsGsaFixMode;
+
+/**
+ * Last GSA PDOP, 0.01
+ */
+uint gpsGsaPdop;
+
+/**
+ * Trip Odometer, Millimeters
+ */
+ulong gpsOdometer;
+
+/**
+ * Odometer Last Point counted, 1e-7 Degrees
+ */
+slong gpsOdometerLatitude;
+slong gpsOdometerLongitude;
+
+/**
+ * Odometer Last Point valid, 0 --> next valid fix is the start point
+ */
+uchar gpsOdometerStart;
+
+/**
+ * Local Time Zone of the published fixes, 15 Minutes steps
+ */
+signed char gpsTimeZone;
+
+#ifdef GPS_SIRF_BINARY
+
+/**
+ * SiRF Binary Frame: 0xA0 0xA2, Length (2), Payload, Checksum (2), 0xB0 0xB3
+ */
+#define	GPS_SIRF_START			0
+#define	GPS_SIRF_LENGTH			2
+#define	GPS_SIRF_PAYLOAD		4
+#define	GPS_SIRF_CHECKSUM		5
+#define	GPS_SIRF_END			7
+
+/**
+ * SiRF Geodetic Navigation Data Message Id and Payload Length
+ */
+#define	GPS_SIRF_MID_GEODETIC	41
+#define	GPS_SIRF_GEODETIC_SIZE	91
+
+/**
+ * SiRF Maximum Payload Length
+ */
+#define	GPS_SIRF_PAYLOAD_SIZE	1023
+
+/**
+ * SiRF Binary Frame State, one state per byte from GPS_SIRF_START to GPS_SIRF_END + 1
  */
-gpsStructNmeaGPRMC structNmeaGPRMC;
+uchar gpsSirfState;
+
+/**
+ * SiRF Payload Length and Index of the next Payload Byte
+ */
+uint gpsSirfLength;
+uint gpsSirfIndex;
+
+/**
+ * SiRF Payload Checksum, 15 bits sum of the Payload Bytes
+ */
+uint gpsSirfChecksum;
+
+/**
+ * SiRF Field being received, Big Endian
+ */
+ulong gpsSirfField;
+
+/**
+ * SiRF Message Id of the Payload being received
+ */
+uchar gpsSirfMid;
+
+/**
+ * SiRF Navigation Valid (0 --> Valid) and Navigation Type
+ */
+uint gpsSirfNavValid;
+uchar gpsSirfNavType;
+
+/**
+ * SiRF UTC Date and Time
+ */
+calendarStructDateTime gpsSirfDateTime;
+
+#endif
+
+/**
+ * GPS UART Handle
+ */
+uartStructHandle *gpsUart;
+
+/**
+ * GPS UART Line Pool
+ */
+uartStructLinePool gpsLinePool;
+
+/**
+ * Complete NMEA Sentence Type waiting for gpsProcess, 0 --> None
+ */
+volatile uchar gpsNmeaSentenceReady;
+
+/**
+ * @brief Reset GPS NMEA Statistics
+ */
+void gpsResetStats()
+{
+	vuchar *stats;
+	uchar i;
+
+	stats = (vuchar *) &gpsStats;
+
+	for(i = 0; i < sizeof(gpsStructStats); i++)
+	{
+		stats[i] = 0;
+	}
+}
+
+/**
+ * @brief Toggle GPS between Hibernate and Full Power, GPS_ON_OFF pulse of GPS_ON_OFF_PULSE
+ */
+void gpsOnOffPulse()
+{
+	ioDigitalWrite(GPS_ON_OFF,ON);
+	delayMs(GPS_ON_OFF_PULSE);
+	ioDigitalWrite(GPS_ON_OFF,OFF);
+}
+
+/**
+ * @brief GPS Awake State
+ * @return 1 --> Full Power (GPS_WAKE high), 0 --> Hibernate
+ */
+uchar gpsAwake()
+{
+	return ioDigitalRead(GPS_WAKE);
+}
+
+/**
+ * @brief GPS Wake Up from Hibernate, waits for GPS_WAKE up to GPS_WAKE_TIMEOUT
+ * @return 1 --> Awake, 0 --> GPS_WAKE did not go high
+ */
+uchar gpsWakeUp()
+{
+	uint time;
+
+	// The pulse toggles the state, a receiver already awake would hibernate
+	if(!gpsAwake())
+	{
+		gpsOnOffPulse();
+	}
+
+	// Wait for GPS WakeUp
+	for(time = 0; !gpsAwake(); time += 10)
+	{
+		if(time >= GPS_WAKE_TIMEOUT)
+		{
+			return 0;
+		}
+
+		delayMs(10);
+	}
 
-uchar i, j, k, l;
+	return 1;
+}
 
 /**
- * @brief GPS Init
+ * @brief GPS Init, the receiver is woken up and configured
+ * @param uart UART Handle connected to the GPS
  */
-void gpsInit(uchar uartId)
+void gpsInit(uartStructHandle *uart)
 {
 	// Capture NMEA Sentence OFF
 	gpsCaptureNMEASentence = 0;
+	gpsNmeaSentenceReady = 0;
+	gpsNmeaSentenceBuffer = gpsLinePool.line[0];
+
+	// Initialize Statistics
+	gpsResetStats();
+
+	// No GPS Fix published
+	gpsFixIndex = 0;
+	gpsFixSequence = 0;
+	gpsFixBuffer[0].sequence = 0;
+
+	// No GPS Epoch in progress
+	gpsEpochTime = 0;
+	gpsEpochSentences = 0;
+	gpsGsaFixMode = 0;
+	gpsGsaPdop = 0;
 
+	// Trip Odometer
+	gpsResetOdometer();
 
-	// Initialize Structs
-	structNmeaGPRMC.isValid = 'N';
-	structNmeaGPRMC.wasRead = 'Y';
+#ifdef GPS_FILTER
+	// Position Filter
+	gpsFilterReset();
+#endif
+
+	// Local Time Zone
+	gpsTimeZone = GPS_TIME_ZONE;
 
 	// Configure GPS Pins
 	ioDigitalOutput(GPS_TX);
@@ -111,372 +382,1222 @@ void gpsInit(uchar uartId)
 	ioDigitalOutput(GPS_ON_OFF);
 	ioDigitalInput(GPS_WAKE);
 
-	// UART init Clock 4MHz
-	uartInit(uartId);
+	gpsUart = uart;
 
-	// UART Read Interrupt
-	uartReadInterrupt(ON);
+#ifdef GPS_SIRF_BINARY
+	// UART Ring Buffer Mode, SiRF Binary Frames are decoded by gpsProcess
+	gpsSirfState = GPS_SIRF_START;
+	uartLineMode(gpsUart, 0, 0);
+#else
+	// UART Line Mode, RX ISR only stores the NMEA Sentences
+	uartLineMode(gpsUart, &gpsLinePool, (const uchar *) "\r\n");
+#endif
 
-	// Start GPS
-	ioDigitalWrite(GPS_ON_OFF,ON);
-	delayMs(200);
-	ioDigitalWrite(GPS_ON_OFF,OFF);
+	uartReadInterrupt(gpsUart, ON);
 
-	// Wait for GPS WakeUp
-	while(ioDigitalRead(GPS_ON_OFF));
+	// Start GPS, reduce the receiver output to the parsed data
+	if(gpsWakeUp())
+	{
+		gpsConfigure();
+	}
 }
 
 /**
- * @brief Receive NMEA Sentence
- * @param GPS Character NMEA Sentence Receive
+ * @brief Parse Complete NMEA Sentence flagged by gpsReceiveNMEASentence
  */
-void gpsReceiveNMEASentence(uchar charReceive)
+void gpsParseNmeaSentence()
 {
-	// Validate First Character NMEA Sentence
-	if(charReceive == '$')
+	// Sentence Types without parser are only validated
+	switch(gpsNmeaSentenceReady)
 	{
-		// Capture NMEA Sentence ON
-		gpsCaptureNMEASentence = 1;
-
-		// Initialize Counter NMEA Identify
-		gpsNmeaSentenceGPGGAIdCounter = 0;
-		gpsNmeaSentenceGPGSAIdCounter = 0;
-		gpsNmeaSentenceGPRMCIdCounter = 0;
-		
-		// Increment Pointer
-		l = 1;
+		// RMC NMEA Sentence
+		case GPS_NMEA_RMC:
+			gpsParseNmeaGPRMCSentence(gpsTimeZone);
+			break;
+		// GGA NMEA Sentence
+		case GPS_NMEA_GGA:
+			gpsParseNmeaGPGGASentence();
+			break;
+		// GSA NMEA Sentence
+		case GPS_NMEA_GSA:
+			gpsParseNmeaGPGSASentence();
+			break;
 	}
-	else
+
+	// Release Sentence Buffer to the collector
+	gpsNmeaSentenceReady = 0;
+}
+
+/**
+ * @brief Process Received NMEA Sentences, call from the main loop
+ */
+void gpsProcess()
+{
+#ifdef GPS_SIRF_BINARY
+	uchar buffer[8];
+	uchar length;
+	uchar i;
+
+	// Bytes stored by the UART RX ISR
+	while((length = uartRead(gpsUart, buffer, sizeof(buffer))))
 	{
-		// If capture is in progress
-		if(gpsCaptureNMEASentence)
+		for(i = 0; i < length; i++)
 		{
-			// Validate NMEA Sentence Type
-			if(l <= 6)
-			{
-				// Evaluate NMEA Sentence Type
-				if(l == 6)
-				{
-					if(charReceive == ',')
-					{
-						j = 0;
-						k = 0;
-
-						// Identify GPGGA NMEA Sentence
-						if(gpsNmeaSentenceGPGGAIdCounter == 5)
-						{
-							i = 0;
-						}
-						// Identify GPGSA NMEA Sentence
-						else if(gpsNmeaSentenceGPGSAIdCounter == 5)
-						{
-							i = 1;
-						}
-						// Identify GPRMC NMEA Sentence
-						else if(gpsNmeaSentenceGPRMCIdCounter == 5)
-						{
-							i = 2;
-						}
-						else
-						{
-							// Capture NMEA Sentence OFF
-							gpsCaptureNMEASentence = 0;
-						}
-					}
-					else
-					{
-						// Capture NMEA Sentence OFF
-						gpsCaptureNMEASentence = 0;
-					}
-				}
-				else
-				{
-					// Validate GPGGA Sentence
-					if(charReceive == gpsNmeaSentenceGPGGAId[l])
-					{
-						gpsNmeaSentenceGPGGAIdCounter++;
-					}
-					// Validate GPGSA Sentence
-					if(charReceive == gpsNmeaSentenceGPGSAId[l])
-					{
-						gpsNmeaSentenceGPGSAIdCounter++;
-					}
-					// Validate GPRMC Sentence
-					if(charReceive == gpsNmeaSentenceGPRMCId[l])
-					{
-						gpsNmeaSentenceGPRMCIdCounter++;
-					}
-				}	
-				
-				// Increment Pointer
-				l++;
-			}
-			else
-			{
-				// Detect Last Character NMEA Sentence
-				if(charReceive == 0x0D)
-				{
-					// Store Receive Character
-					gpsNmeaSentenceBuffer[i][j][k] = charReceive;
-
-					// Increment counter
-					l++;
-
-					// Identify GPGGA NMEA Sentence
-					if(gpsNmeaSentenceGPGGAIdCounter == 5)
-					{
-
-					}
-					// Identify GPGSA NMEA Sentence
-					else if(gpsNmeaSentenceGPGSAIdCounter == 5)
-					{
-
-					}
-					// Identify GPRMC NMEA Sentence
-					else if(gpsNmeaSentenceGPRMCIdCounter == 5)
-					{
-						// Get NMEA GPRMC
-						gpsParseNmeaGPRMCSentence(5);
-					}
-								
-					// Capture Sentence OFF
-					gpsCaptureNMEASentence = 0;
-				}
-				else
-				{				
-					// Increment variable position
-					if(charReceive == ',')
-					{
-						// Last Character Variable
-						gpsNmeaSentenceBuffer[i][j][k] = '\n';
-
-						// Reset Pointers
-						j++;
-						k = 0;
-					}
-					else
-					{
-						// Store Char NMEA Sentence
-						gpsNmeaSentenceBuffer[i][j][k] = charReceive;
-
-						// Point the next character
-						k++;
-					}
-
-					// Increment counter
-					l++;
-				}
-			}
+			gpsReceiveSirfByte(buffer[i]);
 		}
 	}
+#else
+	uchar *line;
+	uchar length;
+
+	// Sentence collected by gpsReceiveNMEASentence from an ISR
+	gpsParseNmeaSentence();
+
+	// Sentences stored by the UART RX ISR
+	while((line = uartReadLine(gpsUart, &length)))
+	{
+		// Sentence parsed in place, the line is released after the parser
+		gpsReceiveNMEALine(line, length);
+		gpsParseNmeaSentence();
+		uartReleaseLine(gpsUart);
+	}
+#endif
 }
 
 /**
- * @brief Obtain and Parse NMEA GPRMC Sentence
- * @param utcTime UTC Time Zone
- * 0,1111111111,2,333333333,4,5555555555,6,7777,88888,999999,10
- * C,181611.863,A,0000.0000,N,00000.0000,W,0.00,40.38,030813,,,A*47
+ * @brief Receive NMEA Sentence, only collects the characters and flags a complete sentence
+ * Safe to call from the UART RX ISR, the sentence is parsed by gpsProcess
+ * @param GPS Character NMEA Sentence Receive
  */
-void gpsParseNmeaGPRMCSentence(uchar utcTimeZone)
+void gpsReceiveNMEASentence(uchar charReceive)
 {
-	volatile uchar tens, units;
-	volatile signed char hourTimeZone;
-	volatile float longitude, latitude;
+	uchar digit;
 
-	// If Sentence is Valid, parse all values
-	if(gpsNmeaSentenceBuffer[2][1][0] == 'A')
+	// Validate First Character NMEA Sentence, skip it while the previous one is not parsed
+	if(charReceive == '$' && !gpsNmeaSentenceReady)
 	{
-		// Obtain RTC Hour
-		tens = gpsNmeaSentenceBuffer[2][0][0] - 0x30;
-		units = gpsNmeaSentenceBuffer[2][0][1] - 0x30;
-		hourTimeZone = (tens * 10) + units - utcTimeZone;
+		// Capture NMEA Sentence ON
+		gpsCaptureNMEASentence = 1;
+
+		// Initialize Checksum
+		gpsNmeaChecksum = 0;
+		gpsNmeaChecksumState = 0;
+
+		// Initialize NMEA Sentence ID Trie
+		gpsNmeaIdState = 1;
 
-		// Obtain RTC Minute
-		tens = gpsNmeaSentenceBuffer[2][0][2] - 0x30;
-		units = gpsNmeaSentenceBuffer[2][0][3] - 0x30;
-		structNmeaGPRMC.rtcMinute = (tens * 10) + units;
+		gpsQtyCharsReceive = 1;
+		return;
+	}
+
+	// If capture is not in progress
+	if(!gpsCaptureNMEASentence)
+	{
+		return;
+	}
 
-		// Obtain RTC Second
-		tens = gpsNmeaSentenceBuffer[2][0][4] - 0x30;
-		units = gpsNmeaSentenceBuffer[2][0][5] - 0x30;
-		structNmeaGPRMC.rtcSecond = (tens * 10) + units;
+	// Detect Last Character NMEA Sentence
+	if(charReceive == 0x0D)
+	{
+		// Capture Sentence OFF
+		gpsCaptureNMEASentence = 0;
 
-		// Obtain RTC Day
-		tens = gpsNmeaSentenceBuffer[2][8][0] - 0x30;
-		units = gpsNmeaSentenceBuffer[2][8][1] - 0x30;
-		structNmeaGPRMC.rtcDay = (tens * 10) + units;
+		// Sentence without Checksum
+		if(gpsNmeaChecksumState != 3)
+		{
+			gpsStats.sentenceChecksumError++;
+			return;
+		}
 
-		// Obtain RTC Month
-		tens = gpsNmeaSentenceBuffer[2][8][2] - 0x30;
-		units = gpsNmeaSentenceBuffer[2][8][3] - 0x30;
-		structNmeaGPRMC.rtcMonth = (tens * 10) + units;
+		gpsNmeaSentenceBuffer[gpsNmeaSentenceLength] = 0;
+		gpsStats.sentenceGood++;
 
-		// Obtain RTC Year
-		tens = gpsNmeaSentenceBuffer[2][8][4] - 0x30;
-		units = gpsNmeaSentenceBuffer[2][8][5] - 0x30;
-		structNmeaGPRMC.rtcYear = (tens * 10) + units;
+		// Flag Sentence to gpsProcess
+		gpsNmeaSentenceReady = gpsNmeaSentenceType;
+		return;
+	}
 
-		// Verify if the hour is negative, and correct situation
-		if(hourTimeZone < 0)
+	// Checksum Digits after '*'
+	if(gpsNmeaChecksumState)
+	{
+		if(charReceive >= '0' && charReceive <= '9')
+		{
+			digit = charReceive - '0';
+		}
+		else if(charReceive >= 'A' && charReceive <= 'F')
 		{
-			structNmeaGPRMC.rtcHour = 24 + hourTimeZone;
-			structNmeaGPRMC.rtcDay--;
+			digit = charReceive - 'A' + 10;
 		}
 		else
 		{
-			structNmeaGPRMC.rtcHour = hourTimeZone;
+			digit = 0xFF;
 		}
 
-		// Obtain Latitude Hour Minute Second
-		latitude = gpsObtainFloatValue(2, 2);
-		structNmeaGPRMC.latitudeHour = (uchar) (latitude/100);
-		structNmeaGPRMC.latitudeMinuteSecond = latitude - (structNmeaGPRMC.latitudeHour * 100);
-
-		// Obtain Longitude Hour Minute Second
-		longitude = gpsObtainFloatValue(2, 4);
-		structNmeaGPRMC.longitudeHour = (uchar) (longitude/100);
-		structNmeaGPRMC.longitudeMinuteSecond = longitude - (structNmeaGPRMC.longitudeHour * 100);
+		// Reject Sentence at the first wrong digit or extra character
+		if(digit == 0xFF || gpsNmeaChecksumState == 3 || digit != ((gpsNmeaChecksumState == 1 ? gpsNmeaChecksum >> 4 : gpsNmeaChecksum) & 0x0F))
+		{
+			gpsStats.sentenceChecksumError++;
+			gpsCaptureNMEASentence = 0;
+			return;
+		}
 
-		// Obtain Speed Over Ground
-		structNmeaGPRMC.speedOverGround = gpsObtainFloatValue(2, 6);
+		gpsNmeaChecksumState++;
+		return;
+	}
 
-		// Obtain Course
-		structNmeaGPRMC.course = gpsObtainFloatValue(2, 7);
+	// Start Checksum, Sentence ID must be complete
+	if(charReceive == '*')
+	{
+		if(gpsQtyCharsReceive <= 6)
+		{
+			gpsStats.sentenceIgnored++;
+			gpsCaptureNMEASentence = 0;
+			return;
+		}
 
-		// Valid Sentence without read
-		structNmeaGPRMC.isValid = 'Y';
-		structNmeaGPRMC.wasRead = 'N';
+		gpsNmeaChecksumState = 1;
+		return;
 	}
-}
-
-/**
- * @brief Obtain Float Value Variable
- * @param nmeaSentence NMEA Sentence
- * @param varPosition Position to convert
- */
-float gpsObtainFloatValue(uchar nmeaSentence, uchar varPosition)
-{
-	uchar i;
-	uint integerPart;
-	uint decimalPart;
-	uint decimalDivisor;
-	uchar qtyDecimal;
-	float value;
 
-	// Initialize Variables
-	i = 0;
-	integerPart = 0;
-	decimalPart = 0;
-	qtyDecimal = 0;
+	// Accumulate Checksum
+	gpsNmeaChecksum ^= charReceive;
 
-	// Obtain integer part
-	while(gpsNmeaSentenceBuffer[nmeaSentence][varPosition][i] != '.')
+	// Validate NMEA Sentence ID, drop the sentence at the first character not wanted
+	if(gpsQtyCharsReceive < 6)
 	{
-		integerPart *= 10;
-		integerPart += (gpsNmeaSentenceBuffer[nmeaSentence][varPosition][i] - 0x30);
-		i++;
+		if(charReceive >= 'A' && charReceive <= 'Z')
+		{
+			gpsNmeaIdState = gpsNmeaIdTrie[gpsNmeaIdState - 1][gpsNmeaIdClass[charReceive - 'A']];
+		}
+		else
+		{
+			gpsNmeaIdState = 0;
+		}
+
+		// Capture NMEA Sentence OFF
+		if(!gpsNmeaIdState)
+		{
+			gpsStats.sentenceIgnored++;
+			gpsCaptureNMEASentence = 0;
+		}
+
+		gpsQtyCharsReceive++;
+		return;
 	}
-	i++;
 
-	// Obtain decimal part
-	while(gpsNmeaSentenceBuffer[nmeaSentence][varPosition][i] != '\n')
+	// Evaluate NMEA Sentence Type
+	if(gpsQtyCharsReceive == 6)
 	{
-		decimalPart *= 10;
-		decimalPart += (gpsNmeaSentenceBuffer[nmeaSentence][varPosition][i] - 0x30);
-		i++;
-		qtyDecimal++;
+		// Sentence ID must be complete
+		if(charReceive == ',' && (gpsNmeaIdState & GPS_NMEA_ID(0)))
+		{
+			gpsNmeaSentenceType = gpsNmeaIdState & ~(GPS_NMEA_ID(0));
+		}
+		else
+		{
+			// Capture NMEA Sentence OFF
+			gpsCaptureNMEASentence = 0;
+		}
+
+		// First Field starts after the Sentence ID
+		gpsNmeaSentenceLength = 0;
+		gpsNmeaFieldOffset[0] = 0;
+		gpsNmeaFieldQty = 1;
+
+		gpsQtyCharsReceive++;
+		return;
 	}
 
-	// Initialize decimal divisor
-	decimalDivisor = 1;
+	// Discard Sentence longer than the buffer
+	if(gpsNmeaSentenceLength >= GPS_NMEA_SENTENCE_SIZE - 1)
+	{
+		gpsStats.sentenceOverflow++;
+		gpsCaptureNMEASentence = 0;
+	}
+	else if(charReceive == ',')
+	{
+		// Discard Sentence with more fields than expected
+		if(gpsNmeaFieldQty == GPS_NMEA_FIELD_QTY)
+		{
+			gpsStats.sentenceOverflow++;
+			gpsCaptureNMEASentence = 0;
+			return;
+		}
 
-	// Calculate decimal divisor
-	for(i = 0; i < qtyDecimal; i++)
+		// Last Character Field, next field starts after it
+		gpsNmeaSentenceBuffer[gpsNmeaSentenceLength++] = 0;
+		gpsNmeaFieldOffset[gpsNmeaFieldQty++] = gpsNmeaSentenceLength;
+	}
+	else
 	{
-		decimalDivisor *= 10;
+		// Store Char NMEA Sentence
+		gpsNmeaSentenceBuffer[gpsNmeaSentenceLength++] = charReceive;
 	}
+}
 
-	// Concatenate integer and decimal part
-	value = integerPart + ((float) decimalPart/(float) decimalDivisor);
+/**
+ * @brief Get GPS NMEA Statistics
+ * @param stats Copy of the GPS NMEA Statistics
+ */
+void gpsGetStats(gpsStructStats *stats)
+{
+	uchar interruptState;
 
-	return value;
+	// Counters are updated by gpsReceiveNMEASentence, maybe from an ISR
+	interruptState = coreSaveInterrupts();
+	*stats = gpsStats;
+	coreRestoreInterrupts(interruptState);
 }
 
 /**
- * Get NMEA RMC Struct
+ * @brief Clear GPS NMEA Statistics
  */
-gpsStructNmeaGPRMC * gpsNmeaGPRMCStruct()
+void gpsClearStats()
 {
-	return &structNmeaGPRMC;
+	uchar interruptState;
+
+	interruptState = coreSaveInterrupts();
+	gpsResetStats();
+	coreRestoreInterrupts(interruptState);
 }
 
+/**
+ * @brief Get NMEA Field of the last complete sentence
+ * @param fieldIndex Field Index, 0 is the first field after the Sentence ID
+ * @return Null terminated Field, empty if the sentence has less fields
+ */
+const uchar * gpsNmeaField(uchar fieldIndex)
+{
+	if(fieldIndex >= gpsNmeaFieldQty)
+	{
+		// Null Character at the end of the sentence
+		return &gpsNmeaSentenceBuffer[gpsNmeaSentenceLength];
+	}
+
+	return &gpsNmeaSentenceBuffer[gpsNmeaFieldOffset[fieldIndex]];
+}
 
 /**
- * @brief Calculate the distance geodesic between two points according to algorithm Thaddeus Vincenty
- *        Adapted Original Version Javascript (C) Chris Veness 2002 - 2012
- *        http://www.movable-type.co.uk/scripts/latlong-vincenty.html
- * @param latitude1 Latitude First Point
- * @param longitude1 Longitude First Point
- * @param latitude2 Latitude Second Point
- * @param longitude2 Longitude Second Point
+ * @brief Get NMEA Field Quantity Characters
+ * @param fieldIndex Field Index, 0 is the first field after the Sentence ID
+ * @return Quantity Characters
  */
-float gpsVincentyDistance(uint latitude1, uint longitude1, uint latitude2, uint longitude2)
+uchar gpsNmeaFieldLength(uchar fieldIndex)
 {
-	float a = 6378137, b = 6356752.314245,  f = 1/298.257223563;  		// WGS-84 ellipsoid params
-	float l = 0;
-	float U1 = 0;
-	float U2 = 0;
-	//float L = (longitude2-longitude1).toRad();
-	//float U1 = atan((1-f) * tan(lat1.toRad()));
-	//float U2 = Math.atan((1-f) * Math.tan(lat2.toRad()));
-	float cosSigma, sigma, sinAlpha, cosSqAlpha, cos2SigmaM, sinLambda, sinSigma, cosLambda, c, lambdaP;
-	float uSq, A, B, deltaSigma, s;
+	const uchar *field;
+	uchar length;
 
-	float sinU1 = sin(U1);
-	float cosU1 = cos(U1);
-	float sinU2 = sin(U2);
-	float cosU2 = cos(U2);
-	float lambda = l;
-	float iterLimit = 100;
+	field = gpsNmeaField(fieldIndex);
+	length = 0;
 
-	do
+	while(field[length])
 	{
-	    sinLambda = sin(lambda);
-	    cosLambda = cos(lambda);
-	    sinSigma = sqrt( (cosU2*sinLambda) * (cosU2*sinLambda) + (cosU1*sinU2 - sinU1*cosU2*cosLambda) * (cosU1*sinU2 - sinU1*cosU2*cosLambda));
+		length++;
+	}
 
-	    if (sinSigma == 0)
-	    {
-	    	return 0;			// Co-incident points
-	    }
+	return length;
+}
 
-	    cosSigma = sinU1*sinU2 + cosU1*cosU2*cosLambda;
-	    sigma = atan2(sinSigma, cosSigma);
-	    sinAlpha = cosU1 * cosU2 * sinLambda / sinSigma;
-	    cosSqAlpha = 1 - sinAlpha*sinAlpha;
-	    cos2SigmaM = cosSigma - 2*sinU1*sinU2/cosSqAlpha;
+/**
+ * @brief Get NMEA Sentence Quantity Fields
+ * @return Quantity Fields after the Sentence ID
+ */
+uchar gpsNmeaQtyFields()
+{
+	return gpsNmeaFieldQty;
+}
 
-	    if (isnan(cos2SigmaM) == 0)
-	    {
-	    	cos2SigmaM = 0;		// Equatorial line: cosSqAlpha=0 (6)
-	    }
-	    c = f/16*cosSqAlpha*(4 + f*(4 - 3*cosSqAlpha));
-	    lambdaP = lambda;
-	    lambda = l + (1-c) * f * sinAlpha * (sigma + c*sinSigma*(cos2SigmaM + c * cosSigma * (-1 + 2 * cos2SigmaM * cos2SigmaM)));
+/**
+ * @brief Parse Two Decimal Digits
+ * @param digits First Digit
+ * @return Value 0 to 99, 0xFF if a character is not a digit
+ */
+uchar gpsParseTwoDigits(const uchar *digits)
+{
+	if(digits[0] < '0' || digits[0] > '9' || digits[1] < '0' || digits[1] > '9')
+	{
+		return 0xFF;
 	}
-	while (abs(lambda-lambdaP) > 1e-12 && --iterLimit>0);
 
-	if (iterLimit == 0)
+	return ((digits[0] - '0') * 10) + (digits[1] - '0');
+}
+
+/**
+ * @brief Validate NMEA Time (hhmmss) and Date (ddmmyy) Fields
+ * @param timeIndex UTC Time Field Index
+ * @param dateIndex Date Field Index
+ * @return 1 if complete, with digits only and every value in range, 0 otherwise
+ */
+uchar gpsValidTimeDate(uchar timeIndex, uchar dateIndex)
+{
+	const uchar *time;
+	const uchar *date;
+	uchar day;
+	uchar month;
+
+	// Fields are only read up to their terminating Null Character
+	if(gpsNmeaFieldLength(timeIndex) < 6 || gpsNmeaFieldLength(dateIndex) != 6)
 	{
-		// return NAN;  			// Formula failed to converge
+		return 0;
 	}
 
-	uSq = cosSqAlpha * (a*a - b*b) / (b*b);
-	A = 1 + uSq/16384*(4096 + uSq*(-768 + uSq*(320 - 175*uSq)));
-	B = uSq/1024 * (256 + uSq*(-128 + uSq*(74 - 47*uSq)));
-	deltaSigma = B*sinSigma*(cos2SigmaM + B/4*(cosSigma*(-1 + 2*cos2SigmaM*cos2SigmaM) -B/6*cos2SigmaM*(-3 + 4*sinSigma*sinSigma)*(-3 + 4*cos2SigmaM*cos2SigmaM)));
-	s = b*A*(sigma - deltaSigma);
+	time = gpsNmeaField(timeIndex);
+	date = gpsNmeaField(dateIndex);
+
+	day = gpsParseTwoDigits(&date[0]);
+	month = gpsParseTwoDigits(&date[2]);
 
-	//s = s.toFixed(3); 		// round to 1mm precision
-	return s;
+	// Second 60 is a Leap Second
+	return gpsParseTwoDigits(&time[0]) < 24 && gpsParseTwoDigits(&time[2]) < 60 && gpsParseTwoDigits(&time[4]) <= 60
+		&& day >= 1 && day <= 31 && month >= 1 && month <= 12 && gpsParseTwoDigits(&date[4]) != 0xFF;
 }
+
+/**
+ * @brief Quantity Integer Digits of a NMEA Field, before the decimal point
+ * @param fieldIndex Field Index
+ * @return Quantity Digits
+ */
+uchar gpsNmeaIntegerDigits(uchar fieldIndex)
+{
+	const uchar *field;
+	uchar digits;
+
+	field = gpsNmeaField(fieldIndex);
+	digits = 0;
+
+	while(field[digits] >= '0' && field[digits] <= '9')
+	{
+		digits++;
+	}
+
+	return digits;
+}
+
+/**
+ * @brief Validate RMC Position, Hemisphere Fields and Coordinate Range
+ * @param latitude Latitude, 1e-7 Degrees
+ * @param longitude Longitude, 1e-7 Degrees
+ * @return 1 if the position is complete and in range, 0 otherwise
+ */
+uchar gpsValidPosition(slong latitude, slong longitude)
+{
+	uchar latitudeHemisphere;
+	uchar longitudeHemisphere;
+
+	latitudeHemisphere = gpsNmeaField(3)[0];
+	longitudeHemisphere = gpsNmeaField(5)[0];
+
+	// Empty Coordinate Fields would be parsed as 0 Degrees
+	if(gpsNmeaFieldLength(2) < 4 || gpsNmeaFieldLength(4) < 5)
+	{
+		return 0;
+	}
+
+	// Extra Degree Digits, ddmm and dddmm, the value is not a coordinate
+	if(gpsNmeaIntegerDigits(2) > GPS_LATITUDE_DIGITS || gpsNmeaIntegerDigits(4) > GPS_LONGITUDE_DIGITS)
+	{
+		return 0;
+	}
+
+	if((latitudeHemisphere != 'N' && latitudeHemisphere != 'S') || (longitudeHemisphere != 'E' && longitudeHemisphere != 'W'))
+	{
+		return 0;
+	}
+
+	// Minutes above 59 or more than 180 Degrees (GPS_COORDINATE_INVALID) are out of range
+	return latitude >= -90 * GPS_COORDINATE_SCALE && latitude <= 90 * GPS_COORDINATE_SCALE
+		&& longitude >= -180 * GPS_COORDINATE_SCALE && longitude <= 180 * GPS_COORDINATE_SCALE;
+}
+
+/**
+ * @brief Receive Complete NMEA Sentence from UART Line Mode
+ * The fields are stored in place over the line, it must be kept until gpsProcess parses it
+ * @param line NMEA Sentence without delimiter
+ * @param length Quantity Characters
+ */
+void gpsReceiveNMEALine(uchar *line, uchar length)
+{
+	uchar position;
+
+	// Each field character is stored at least 7 positions ("$GPRMC,") behind the character read
+	if(!gpsNmeaSentenceReady)
+	{
+		gpsNmeaSentenceBuffer = line;
+	}
+
+	for(position = 0; position < length; position++)
+	{
+		gpsReceiveNMEASentence(line[position]);
+	}
+
+	// Last Character NMEA Sentence
+	gpsReceiveNMEASentence(0x0D);
+}
+
+/**
+ * @brief Reset Trip Odometer, the next valid fix is the new start point
+ */
+void gpsResetOdometer()
+{
+	gpsOdometer = 0;
+	gpsOdometerStart = 0;
+}
+
+/**
+ * @brief Get Trip Odometer, updated by gpsProcess on each published fix
+ * @return Distance in Millimeters since gpsInit or gpsResetOdometer, wraps after 4294 Km
+ */
+ulong gpsGetOdometer()
+{
+	return gpsOdometer;
+}
+
+/**
+ * @brief Add the distance from the last counted point to the new GPS Fix
+ * Stationary fixes keep the last point so the jitter around it is not accumulated
+ * @param fix GPS Fix being published
+ */
+void gpsOdometerUpdate(const gpsStructNmeaGPRMC *fix)
+{
+	ulong distance;
+
+	// Poor geometry, position not trusted (hdop 0 --> no GGA received)
+	if((*fix).quality.hdop > GPS_ODOMETER_MAX_HDOP)
+	{
+		return;
+	}
+
+	// First point
+	if(!gpsOdometerStart)
+	{
+		gpsOdometerLatitude = (*fix).latitude;
+		gpsOdometerLongitude = (*fix).longitude;
+		gpsOdometerStart = 1;
+		return;
+	}
+
+	// Stationary, keep the last point
+	if((*fix).speedOverGround < GPS_ODOMETER_MIN_SPEED)
+	{
+		return;
+	}
+
+	// Local plane distance is accurate for the distance between consecutive fixes
+	distance = distanceEquirectangular(gpsOdometerLatitude, gpsOdometerLongitude, (*fix).latitude, (*fix).longitude);
+
+	// Centimeters to Millimeters
+	gpsOdometer += distance * (1000 / DISTANCE_SCALE);
+
+	gpsOdometerLatitude = (*fix).latitude;
+	gpsOdometerLongitude = (*fix).longitude;
+}
+
+/**
+ * @brief Publish the Buffer not published as the new GPS Fix
+ */
+void gpsPublishFix()
+{
+	gpsStructNmeaGPRMC *structNmeaGPRMC;
+
+	structNmeaGPRMC = &gpsFixBuffer[gpsFixIndex ^ 1];
+
+	// Last GSA received
+	(*structNmeaGPRMC).quality.fixMode = gpsGsaFixMode;
+	(*structNmeaGPRMC).quality.pdop = gpsGsaPdop;
+
+#ifdef GPS_FILTER
+	// Smoothed position for the odometer and the consumers, a jump is not travelled, the odometer starts again from the new position
+	if(!gpsFilterUpdate(structNmeaGPRMC))
+	{
+		gpsOdometerStart = 0;
+	}
+#endif
+
+	// Published from gpsProcess, not from an ISR
+	gpsOdometerUpdate(structNmeaGPRMC);
+
+	(*structNmeaGPRMC).sequence = gpsFixSequence + 1;
+	gpsFixIndex ^= 1;
+	gpsFixSequence = (*structNmeaGPRMC).sequence;
+
+	// Epoch complete, later sentences of the same epoch are not published
+	gpsEpochSentences = 0;
+}
+
+/**
+ * @brief Get Buffer not published for the epoch of the sentence being parsed
+ * A new epoch publishes the previous one if it had a valid RMC without GGA
+ * @param time NMEA UTC Time Field (hhmmss.ss)
+ */
+gpsStructNmeaGPRMC * gpsEpochFix(const uchar *time)
+{
+	gpsStructNmeaGPRMC *structNmeaGPRMC;
+	ulong epochTime;
+
+	epochTime = gpsParseFixed(time, 2);
+
+	if(epochTime != gpsEpochTime)
+	{
+		// Receiver without GGA, publish previous epoch now
+		if(gpsEpochSentences == GPS_EPOCH_RMC)
+		{
+			gpsPublishFix();
+		}
+
+		gpsEpochTime = epochTime;
+		gpsEpochSentences = 0;
+
+		// GGA not received yet for the new epoch
+		structNmeaGPRMC = &gpsFixBuffer[gpsFixIndex ^ 1];
+		(*structNmeaGPRMC).quality.fixQuality = 0;
+		(*structNmeaGPRMC).quality.satellites = 0;
+		(*structNmeaGPRMC).quality.hdop = 0;
+		(*structNmeaGPRMC).quality.altitude = 0;
+	}
+
+	return &gpsFixBuffer[gpsFixIndex ^ 1];
+}
+
+/**
+ * @brief Append a Decimal Digit to a Fixed-Point Value, saturated at 32 bits
+ * @param value Value, GPS_FIXED_OVERFLOW stays
+ * @param digit Digit 0 to 9
+ * @return value * 10 + digit, GPS_FIXED_OVERFLOW if it does not fit in 32 bits
+ */
+ulong gpsFixedDigit(ulong value, uchar digit)
+{
+	// 429496729 * 10 + 5 is 0xFFFFFFFF, compared without division (no divider on the targets)
+	if(value > 429496729UL || (value == 429496729UL && digit > 5))
+	{
+		return GPS_FIXED_OVERFLOW;
+	}
+
+	return value * 10 + digit;
+}
+
+/**
+ * @brief Parse NMEA Decimal Field to Fixed-Point
+ * @param field NMEA Field, ends at the first character that is not a digit or the decimal point
+ * @param qtyDecimals Quantity Decimals kept, truncated or padded with zeros, up to GPS_FIXED_MAX_DECIMALS
+ * @return Field Value * 10^qtyDecimals, GPS_FIXED_OVERFLOW if it does not fit in 32 bits
+ */
+ulong gpsParseFixed(const uchar *field, uchar qtyDecimals)
+{
+	ulong value;
+	uchar i;
+
+	value = 0;
+
+	if(qtyDecimals > GPS_FIXED_MAX_DECIMALS)
+	{
+		qtyDecimals = GPS_FIXED_MAX_DECIMALS;
+	}
+
+	// Obtain integer part, too many digits saturate instead of wrapping back into range
+	while(*field >= '0' && *field <= '9')
+	{
+		value = gpsFixedDigit(value, *field - '0');
+		field++;
+	}
+
+	if(*field == '.')
+	{
+		field++;
+	}
+
+	// Obtain decimal part, missing digits are zeros
+	for(i = 0; i < qtyDecimals; i++)
+	{
+		if(*field >= '0' && *field <= '9')
+		{
+			value = gpsFixedDigit(value, *field - '0');
+			field++;
+		}
+		else
+		{
+			value = gpsFixedDigit(value, 0);
+		}
+	}
+
+	return value;
+}
+
+/**
+ * @brief Set Local Time Zone of the published fixes, GPS_TIME_ZONE after gpsInit
+ * @param timeZone Time Zone in 15 Minutes steps (Ex. UTC-5 --> -20, UTC+5:30 --> 22)
+ */
+void gpsSetTimeZone(signed char timeZone)
+{
+	gpsTimeZone = timeZone;
+}
+
+/**
+ * @brief Set UTC Unix Time and Local Time of the GPS Fix
+ * @param fix GPS Fix
+ * @param dateTime UTC Date and Time, changed to Local Date and Time
+ * @param timeZone Local Time Zone in 15 Minutes steps
+ */
+void gpsSetFixTime(gpsStructNmeaGPRMC *fix, calendarStructDateTime *dateTime, signed char timeZone)
+{
+	(*fix).epoch = calendarToEpoch(dateTime);
+
+	// Local Time, day, month and year follow the time zone
+	calendarFromEpoch((*fix).epoch, timeZone, dateTime);
+
+	(*fix).rtcHour = (*dateTime).hour;
+	(*fix).rtcMinute = (*dateTime).minute;
+	(*fix).rtcSecond = (*dateTime).second;
+	(*fix).rtcDay = (*dateTime).day;
+	(*fix).rtcMonth = (*dateTime).month;
+	(*fix).rtcYear = (uchar) ((*dateTime).year % 100);
+}
+
+/**
+ * @brief Obtain and Parse NMEA GPRMC Sentence
+ * @param timeZone Local Time Zone in 15 Minutes steps (Ex. UTC-5 --> -20, UTC+5:30 --> 22)
+ * 0,1111111111,2,333333333,4,5555555555,6,7777,88888,999999,10
+ * C,181611.863,A,0000.0000,N,00000.0000,W,0.00,40.38,030813,,,A*47
+ */
+void gpsParseNmeaGPRMCSentence(signed char timeZone)
+{
+	const uchar *time;
+	const uchar *date;
+	calendarStructDateTime dateTime;
+	slong latitude;
+	slong longitude;
+	gpsStructNmeaGPRMC *structNmeaGPRMC;
+
+	time = gpsNmeaField(0);
+	date = gpsNmeaField(8);
+
+	latitude = gpsParseCoordinate(gpsNmeaField(2), gpsNmeaField(3)[0]);
+	longitude = gpsParseCoordinate(gpsNmeaField(4), gpsNmeaField(5)[0]);
+
+	// If Sentence is Valid with time, date and position in range, parse all values
+	if(gpsNmeaField(1)[0] == 'A' && gpsValidTimeDate(0, 8) && gpsValidPosition(latitude, longitude))
+	{
+		// Fill the buffer not published
+		structNmeaGPRMC = gpsEpochFix(time);
+
+		// Obtain UTC Time and Date
+		dateTime.hour = gpsParseTwoDigits(&time[0]);
+		dateTime.minute = gpsParseTwoDigits(&time[2]);
+		dateTime.second = gpsParseTwoDigits(&time[4]);
+		dateTime.day = gpsParseTwoDigits(&date[0]);
+		dateTime.month = gpsParseTwoDigits(&date[2]);
+		dateTime.year = 2000 + gpsParseTwoDigits(&date[4]);
+
+		// UTC Unix Time and Local Time
+		gpsSetFixTime(structNmeaGPRMC, &dateTime, timeZone);
+
+		// Obtain Latitude and Longitude
+		(*structNmeaGPRMC).latitude = latitude;
+		(*structNmeaGPRMC).longitude = longitude;
+
+		// Obtain Speed Over Ground
+		(*structNmeaGPRMC).speedOverGround = (uint) gpsParseFixed(gpsNmeaField(6), 2);
+
+		// Obtain Course
+		(*structNmeaGPRMC).course = (uint) gpsParseFixed(gpsNmeaField(7), 2);
+
+		// Publish GPS Fix when GGA of the same epoch was received
+		gpsEpochSentences |= GPS_EPOCH_RMC;
+
+		if(gpsEpochSentences == (GPS_EPOCH_RMC | GPS_EPOCH_GGA))
+		{
+			gpsPublishFix();
+		}
+	}
+	else
+	{
+		gpsStats.fixRejected++;
+	}
+}
+
+/**
+ * @brief Obtain and Parse NMEA GPGGA Sentence
+ * 0,111111111,2,333333333,4,5,66,777,88888,9,10,11,12,13
+ * C,123519.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47
+ */
+void gpsParseNmeaGPGGASentence()
+{
+	gpsStructNmeaGPRMC *structNmeaGPRMC;
+
+	// Fill the buffer not published, Latitude and Longitude are taken from RMC
+	structNmeaGPRMC = gpsEpochFix(gpsNmeaField(0));
+
+	// Obtain Fix Quality and Satellites used
+	(*structNmeaGPRMC).quality.fixQuality = (uchar) gpsParseFixed(gpsNmeaField(5), 0);
+	(*structNmeaGPRMC).quality.satellites = (uchar) gpsParseFixed(gpsNmeaField(6), 0);
+
+	// Obtain HDOP and Altitude
+	(*structNmeaGPRMC).quality.hdop = (uint) gpsParseFixed(gpsNmeaField(7), 2);
+	(*structNmeaGPRMC).quality.altitude = gpsParseSignedFixed(gpsNmeaField(8), 2);
+
+	// Publish GPS Fix when RMC of the same epoch was valid
+	gpsEpochSentences |= GPS_EPOCH_GGA;
+
+	if(gpsEpochSentences == (GPS_EPOCH_RMC | GPS_EPOCH_GGA))
+	{
+		gpsPublishFix();
+	}
+}
+
+/**
+ * @brief Obtain and Parse NMEA GPGSA Sentence, used in the next published fix
+ * 0,1,2..13,14,15,16
+ * C,A,3,04,05,,09,12,,,24,,,,,2.5,1.3,2.1*39
+ */
+void gpsParseNmeaGPGSASentence()
+{
+	gpsGsaFixMode = (uchar) gpsParseFixed(gpsNmeaField(1), 0);
+	gpsGsaPdop = (uint) gpsParseFixed(gpsNmeaField(14), 2);
+}
+
+/**
+ * @brief Parse NMEA Signed Decimal Field to Fixed-Point
+ * @param field NMEA Field, optional '-' sign
+ * @param qtyDecimals Quantity Decimals kept, truncated or padded with zeros
+ * @return Field Value * 10^qtyDecimals
+ */
+slong gpsParseSignedFixed(const uchar *field, uchar qtyDecimals)
+{
+	// Negate unsigned, a field too long for slong can not overflow
+	if(*field == '-')
+	{
+		return (slong) (0 - gpsParseFixed(field + 1, qtyDecimals));
+	}
+
+	return (slong) gpsParseFixed(field, qtyDecimals);
+}
+
+/**
+ * @brief Parse NMEA Coordinate Field to Fixed-Point Degrees
+ * @param field NMEA Latitude (ddmm.mmmmm) or Longitude (dddmm.mmmmm) Field
+ * @param hemisphere N, S, E or W
+ * @return Coordinate in 1e-7 Degrees, South and West negative, GPS_COORDINATE_INVALID if the minutes are 60 or more
+ */
+slong gpsParseCoordinate(const uchar *field, uchar hemisphere)
+{
+	ulong degreesMinutes;
+	slong coordinate;
+
+	// Degrees and Minutes, 5 Decimals of Minute --> dddmm * 100000 + mmmmm
+	degreesMinutes = gpsParseFixed(field, 5);
+
+	// Minutes 60 or more would carry into the degrees, above 180 Degrees includes GPS_FIXED_OVERFLOW
+	if(degreesMinutes % (100 * GPS_COORDINATE_MINUTE_SCALE) >= 60 * GPS_COORDINATE_MINUTE_SCALE
+		|| degreesMinutes > 180 * 100 * GPS_COORDINATE_MINUTE_SCALE)
+	{
+		return GPS_COORDINATE_INVALID;
+	}
+
+	// Minutes * 100000 to 1e-7 Degrees --> * 100 / 60, rounded
+	coordinate = (slong) ((degreesMinutes / (100 * GPS_COORDINATE_MINUTE_SCALE)) * GPS_COORDINATE_SCALE);
+	coordinate += (slong) (((degreesMinutes % (100 * GPS_COORDINATE_MINUTE_SCALE)) * 5 + 1) / 3);
+
+	if(hemisphere == 'S' || hemisphere == 'W')
+	{
+		coordinate = -coordinate;
+	}
+
+	return coordinate;
+}
+
+#if defined(GPS_SIRF) || defined(GPS_MTK)
+
+/**
+ * @brief Send NMEA Command, polling the UART, '$', checksum and delimiter are added
+ * @param command Command without '$' and checksum (Ex. "PMTK220,1000")
+ */
+void gpsSendNmeaCommand(const uchar *command)
+{
+	uchar checksum;
+	uchar i;
+
+	checksum = 0;
+	uartWriteByte(gpsUart, '$');
+
+	for(i = 0; command[i]; i++)
+	{
+		checksum ^= command[i];
+		uartWriteByte(gpsUart, command[i]);
+	}
+
+	uartWriteByte(gpsUart, '*');
+	uartWriteByte(gpsUart, "0123456789ABCDEF"[checksum >> 4]);
+	uartWriteByte(gpsUart, "0123456789ABCDEF"[checksum & 0x0F]);
+	uartWriteByte(gpsUart, 0x0D);
+	uartWriteByte(gpsUart, 0x0A);
+}
+
+/**
+ * @brief Format Command with a Decimal Parameter
+ * @param command Destination, null terminated
+ * @param prefix Text before the Parameter
+ * @param value Parameter
+ * @param suffix Text after the Parameter
+ */
+void gpsFormatCommand(uchar *command, const char *prefix, ulong value, const char *suffix)
+{
+	uchar digits[10];
+	uchar qtyDigits;
+	uchar i;
+
+	for(i = 0; prefix[i]; i++)
+	{
+		command[i] = prefix[i];
+	}
+
+	// Digits from the least significant one
+	qtyDigits = 0;
+
+	do
+	{
+		digits[qtyDigits++] = '0' + (uchar) (value % 10);
+		value /= 10;
+	}
+	while(value);
+
+	while(qtyDigits)
+	{
+		command[i++] = digits[--qtyDigits];
+	}
+
+	while(*suffix)
+	{
+		command[i++] = *suffix++;
+	}
+
+	command[i] = 0;
+}
+
+#endif
+
+#ifdef GPS_SIRF_BINARY
+
+/**
+ * @brief Send SiRF Binary Message, polling the UART
+ * @param payload Message Id and Message Data
+ * @param length Payload Length
+ */
+void gpsSendSirfMessage(const uchar *payload, uchar length)
+{
+	uint checksum;
+	uchar i;
+
+	uartWriteByte(gpsUart, 0xA0);
+	uartWriteByte(gpsUart, 0xA2);
+	uartWriteByte(gpsUart, 0);
+	uartWriteByte(gpsUart, length);
+
+	checksum = 0;
+
+	for(i = 0; i < length; i++)
+	{
+		checksum = (checksum + payload[i]) & 0x7FFF;
+		uartWriteByte(gpsUart, payload[i]);
+	}
+
+	uartWriteByte(gpsUart, (uchar) (checksum >> 8));
+	uartWriteByte(gpsUart, (uchar) checksum);
+	uartWriteByte(gpsUart, 0xB0);
+	uartWriteByte(gpsUart, 0xB3);
+}
+
+/**
+ * SiRF Set Message Rate (MID 166), all messages off
+ */
+const uchar gpsSirfMessagesOff[] = {166, 2, 0, 0, 0, 0, 0, 0};
+
+/**
+ * SiRF Set Message Rate (MID 166), Geodetic Navigation Data (MID 41) every second
+ */
+const uchar gpsSirfGeodeticOn[] = {166, 0, GPS_SIRF_MID_GEODETIC, 1, 0, 0, 0, 0};
+
+#endif
+
+/**
+ * @brief Send Receiver Configuration (GPS_SIRF or GPS_MTK), polling the UART, called by gpsInit
+ * Turns off the unused NMEA Sentences, sets GPS_FIX_RATE and switches to binary with GPS_SIRF_BINARY
+ */
+void gpsConfigure()
+{
+#if defined(GPS_SIRF_BINARY) || defined(GPS_MTK)
+	uchar command[32];
+#endif
+
+#ifdef GPS_SIRF
+	// NMEA Output Control ($PSRF103,Message,Mode,Rate,Checksum), GLL, GSV and VTG off
+	gpsSendNmeaCommand((const uchar *) "PSRF103,01,00,00,01");
+	gpsSendNmeaCommand((const uchar *) "PSRF103,03,00,00,01");
+	gpsSendNmeaCommand((const uchar *) "PSRF103,05,00,00,01");
+
+	// GGA, GSA and RMC every second
+	gpsSendNmeaCommand((const uchar *) "PSRF103,00,00,01,01");
+	gpsSendNmeaCommand((const uchar *) "PSRF103,02,00,01,01");
+	gpsSendNmeaCommand((const uchar *) "PSRF103,04,00,01,01");
+
+#ifdef GPS_SIRF_BINARY
+	// Switch to SiRF Binary at the same Baud Rate ($PSRF100,Protocol,Baud,Data,Stop,Parity)
+	gpsFormatCommand(command, "PSRF100,0,", SCI1_BPS, ",8,1,0");
+	gpsSendNmeaCommand(command);
+
+	// Receiver restarts the port, then only Geodetic Navigation Data
+	delayMs(100);
+	gpsSendSirfMessage(gpsSirfMessagesOff, sizeof(gpsSirfMessagesOff));
+	gpsSendSirfMessage(gpsSirfGeodeticOn, sizeof(gpsSirfGeodeticOn));
+#endif
+#endif
+
+#ifdef GPS_MTK
+	// NMEA Output Frequencies (GLL, RMC, VTG, GGA, GSA, GSV, ...), only RMC, GGA and GSA
+	gpsSendNmeaCommand((const uchar *) "PMTK314,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0");
+
+	// Fix Interval in Milliseconds
+	gpsFormatCommand(command, "PMTK220,", 1000 / GPS_FIX_RATE, "");
+	gpsSendNmeaCommand(command);
+#endif
+}
+
+#ifdef GPS_SIRF_BINARY
+
+/**
+ * @brief Sign Extension of a 32 bits SiRF Field
+ * @param field Field, the low 32 bits are used
+ * @return Signed Value
+ */
+slong gpsSirfSigned(ulong field)
+{
+	field &= 0xFFFFFFFFUL;
+
+	if(field & 0x80000000UL)
+	{
+		return -(slong) (0xFFFFFFFFUL - field) - 1;
+	}
+
+	return (slong) field;
+}
+
+/**
+ * @brief Receive SiRF Binary Byte, Geodetic Navigation Data (MID 41) is published as GPS Fix
+ * Fields are stored in the buffer not published while the payload is received, no payload buffer
+ * @param byteReceive Byte received from the GPS
+ */
+void gpsReceiveSirfByte(uchar byteReceive)
+{
+	gpsStructNmeaGPRMC *structNmeaGPRMC;
+	uchar navType;
+
+	structNmeaGPRMC = &gpsFixBuffer[gpsFixIndex ^ 1];
+
+	switch(gpsSirfState)
+	{
+		// Start Sequence 0xA0 0xA2
+		case GPS_SIRF_START:
+			if(byteReceive == 0xA0)
+			{
+				gpsSirfState++;
+			}
+			break;
+		case GPS_SIRF_START + 1:
+			if(byteReceive == 0xA2)
+			{
+				gpsSirfState++;
+			}
+			else if(byteReceive != 0xA0)
+			{
+				gpsSirfState = GPS_SIRF_START;
+			}
+			break;
+		// Payload Length, 15 bits Big Endian
+		case GPS_SIRF_LENGTH:
+			gpsSirfLength = (uint) (byteReceive & 0x7F) << 8;
+			gpsSirfState++;
+			break;
+		case GPS_SIRF_LENGTH + 1:
+			gpsSirfLength |= byteReceive;
+			gpsSirfIndex = 0;
+			gpsSirfChecksum = 0;
+			gpsSirfField = 0;
+			gpsSirfState = GPS_SIRF_PAYLOAD;
+
+			// Lost synchronization
+			if(gpsSirfLength == 0 || gpsSirfLength > GPS_SIRF_PAYLOAD_SIZE)
+			{
+				gpsStats.sentenceOverflow++;
+				gpsSirfState = GPS_SIRF_START;
+			}
+			break;
+		// Payload, Geodetic Navigation Data fields are stored at their last byte
+		case GPS_SIRF_PAYLOAD:
+			gpsSirfChecksum = (gpsSirfChecksum + byteReceive) & 0x7FFF;
+			gpsSirfField = (gpsSirfField << 8) | byteReceive;
+
+			if(gpsSirfIndex == 0)
+			{
+				gpsSirfMid = byteReceive;
+			}
+			else if(gpsSirfMid == GPS_SIRF_MID_GEODETIC && gpsSirfLength == GPS_SIRF_GEODETIC_SIZE)
+			{
+				switch(gpsSirfIndex)
+				{
+					case 2:
+						gpsSirfNavValid = (uint) (gpsSirfField & 0xFFFF);
+						break;
+					case 4:
+						gpsSirfNavType = byteReceive;
+						break;
+					case 12:
+						gpsSirfDateTime.year = (uint) (gpsSirfField & 0xFFFF);
+						break;
+					case 13:
+						gpsSirfDateTime.month = byteReceive;
+						break;
+					case 14:
+						gpsSirfDateTime.day = byteReceive;
+						break;
+					case 15:
+						gpsSirfDateTime.hour = byteReceive;
+						break;
+					case 16:
+						gpsSirfDateTime.minute = byteReceive;
+						break;
+					// Seconds in Milliseconds
+					case 18:
+						gpsSirfDateTime.second = (uchar) ((gpsSirfField & 0xFFFF) / 1000);
+						break;
+					// Latitude and Longitude 1e-7 Degrees, same scale of GPS_COORDINATE_SCALE
+					case 26:
+						(*structNmeaGPRMC).latitude = gpsSirfSigned(gpsSirfField);
+						break;
+					case 30:
+						(*structNmeaGPRMC).longitude = gpsSirfSigned(gpsSirfField);
+						break;
+					// Altitude from Mean Sea Level, Centimeters
+					case 38:
+						(*structNmeaGPRMC).quality.altitude = gpsSirfSigned(gpsSirfField);
+						break;
+					// Speed Over Ground cm/s to 0.01 Knots (1.943844 --> 31849 / 16384)
+					case 41:
+						(*structNmeaGPRMC).speedOverGround = (uint) (((gpsSirfField & 0xFFFF) * 31849UL) >> 14);
+						break;
+					// Course Over Ground, 0.01 Degrees
+					case 43:
+						(*structNmeaGPRMC).course = (uint) (gpsSirfField & 0xFFFF);
+						break;
+					case 88:
+						(*structNmeaGPRMC).quality.satellites = byteReceive;
+						break;
+					// HDOP 0.2 to 0.01
+					case 89:
+						(*structNmeaGPRMC).quality.hdop = (uint) byteReceive * 20;
+						break;
+				}
+			}
+
+			if(++gpsSirfIndex == gpsSirfLength)
+			{
+				gpsSirfState = GPS_SIRF_CHECKSUM;
+			}
+			break;
+		// Checksum, 15 bits Big Endian
+		case GPS_SIRF_CHECKSUM:
+			gpsSirfField = byteReceive;
+			gpsSirfState++;
+			break;
+		case GPS_SIRF_CHECKSUM + 1:
+			if((((uint) gpsSirfField << 8) | byteReceive) == gpsSirfChecksum)
+			{
+				gpsSirfState++;
+			}
+			else
+			{
+				gpsStats.sentenceChecksumError++;
+				gpsSirfState = GPS_SIRF_START;
+			}
+			break;
+		// End Sequence 0xB0 0xB3
+		case GPS_SIRF_END:
+			gpsSirfState = byteReceive == 0xB0 ? GPS_SIRF_END + 1 : GPS_SIRF_START;
+			break;
+		case GPS_SIRF_END + 1:
+			gpsSirfState = GPS_SIRF_START;
+
+			if(byteReceive != 0xB3)
+			{
+				break;
+			}
+
+			gpsStats.sentenceGood++;
+
+			if(gpsSirfMid != GPS_SIRF_MID_GEODETIC || gpsSirfLength != GPS_SIRF_GEODETIC_SIZE)
+			{
+				gpsStats.sentenceIgnored++;
+				break;
+			}
+
+			// Navigation valid with date, time and position in range
+			if(gpsSirfNavValid || gpsSirfDateTime.year < 2000 || gpsSirfDateTime.year > 2099 || gpsSirfDateTime.month < 1 || gpsSirfDateTime.month > 12 || gpsSirfDateTime.day < 1 || gpsSirfDateTime.day > 31 || gpsSirfDateTime.hour > 23 || gpsSirfDateTime.minute > 59 || gpsSirfDateTime.second > 60
+				|| (*structNmeaGPRMC).latitude > 90 * GPS_COORDINATE_SCALE || (*structNmeaGPRMC).latitude < -90 * GPS_COORDINATE_SCALE
+				|| (*structNmeaGPRMC).longitude > 180 * GPS_COORDINATE_SCALE || (*structNmeaGPRMC).longitude < -180 * GPS_COORDINATE_SCALE)
+			{
+				gpsStats.fixRejected++;
+				break;
+			}
+
+			gpsSetFixTime(structNmeaGPRMC, &gpsSirfDateTime, gpsTimeZone);
+
+			// Navigation Type, bits 0 to 2 --> 4 and 6 3D, 3 and 5 2D, bit 7 --> DGPS
+			navType = gpsSirfNavType & 0x07;
+			(*structNmeaGPRMC).quality.fixQuality = (gpsSirfNavType & 0x80) ? 2 : 1;
+			gpsGsaFixMode = (navType == 4 || navType == 6) ? 3 : ((navType == 3 || navType == 5) ? 2 : 1);
+			gpsGsaPdop = 0;
+
+			gpsPublishFix();
+			break;
+	}
+}
+
+#endif
+
+#ifdef GPS_FLOAT_API
+
+/**
+ * @brief Convert Fixed-Point Value to Float
+ * @param value Fixed-Point Value
+ * @param scale Value Scale (Ex. GPS_COORDINATE_SCALE)
+ */
+float gpsFixedToFloat(slong value, slong scale)
+{
+	return (float) value / (float) scale;
+}
+
+/**
+ * @brief Obtain Float Value of NMEA Field
+ * @param fieldIndex Field Index, 0 is the first field after the Sentence ID
+ */
+float gpsObtainFloatValue(uchar fieldIndex)
+{
+	return (float) gpsParseFixed(gpsNmeaField(fieldIndex), 5) / 100000.0;
+}
+
+#endif
+
+/**
+ * @brief Get Consistent Copy of the last GPS Fix, without disabling interrupts
+ * @param fix Copy of the GPS Fix, fix->sequence changes when a new fix is available
+ */
+void gpsGetFix(gpsStructNmeaGPRMC *fix)
+{
+	ulong sequence;
+
+	// Copy again if a new fix was published during the copy
+	do
+	{
+		sequence = gpsFixSequence;
+		*fix = gpsFixBuffer[gpsFixIndex];
+	}
+	while(sequence != gpsFixSequence);
+}
+
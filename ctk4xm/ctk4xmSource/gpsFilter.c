@@ -0,0 +1,232 @@
+/**
+ *  @file gpsFilter.c
+ *  @brief Module that Smooths GPS Position and Velocity with a Fixed-Point Alpha-Beta Filter
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gpsFilter.h"
+
+/**
+ * Position Gain (alpha) Q8 by HDOP / 0.5, moving and stationary
+ * Steady-state Kalman with measurement noise 4 m * HDOP and acceleration noise 4 m/s^2 (0.05 m/s^2 stationary)
+ */
+const uchar gpsFilterAlpha[2][GPS_FILTER_QTY_GAINS] =
+{
+	{219, 204, 182, 167, 155, 146, 139, 132, 127, 122, 118, 114, 110, 107, 104, 102},
+	{51, 43, 34, 29, 26, 23, 21, 20, 19, 18, 17, 16, 16, 15, 15, 14}
+};
+
+/**
+ * Velocity Gain (beta) Q8 by HDOP / 0.5, moving and stationary
+ */
+const uchar gpsFilterBeta[2][GPS_FILTER_QTY_GAINS] =
+{
+	{196, 154, 110, 86, 71, 61, 53, 47, 43, 39, 36, 33, 31, 29, 27, 26},
+	{6, 4, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}
+};
+
+/**
+ * Filtered Position, 1e-7 Degrees
+ */
+slong gpsFilterLatitude;
+slong gpsFilterLongitude;
+
+/**
+ * Filtered Velocity, 1e-7 Degrees per fix
+ */
+slong gpsFilterLatitudeRate;
+slong gpsFilterLongitudeRate;
+
+/**
+ * UTC Unix Time of the last fix filtered
+ */
+ulong gpsFilterEpoch;
+
+/**
+ * Filter State valid, 0 --> next fix restarts the filter
+ */
+uchar gpsFilterValid;
+
+/**
+ * @brief Restart the Filter, the next fix is taken without smoothing
+ */
+void gpsFilterReset()
+{
+	gpsFilterValid = 0;
+	gpsFilterLatitudeRate = 0;
+	gpsFilterLongitudeRate = 0;
+}
+
+/**
+ * @brief Multiply by a Q8 Gain, rounded to zero for both signs
+ * @param value Value
+ * @param gain Gain Q8
+ * @return value * gain / 256
+ */
+slong gpsFilterGain(slong value, uchar gain)
+{
+	if(value < 0)
+	{
+		return -(slong) (((ulong) -value * gain) >> 8);
+	}
+
+	return (slong) (((ulong) value * gain) >> 8);
+}
+
+/**
+ * @brief Innovation between the Measurement and the Prediction
+ * @param measurement Measurement, 1e-7 Degrees
+ * @param prediction Prediction, 1e-7 Degrees
+ * @param wrap GPS_FILTER_FULL_TURN for longitude (shorter way around the 180 Degrees Meridian), 0 for latitude
+ * @param innovation Measurement - Prediction
+ * @return 1 --> Valid, 0 --> Larger than GPS_FILTER_MAX_JUMP
+ */
+uchar gpsFilterInnovation(slong measurement, slong prediction, ulong wrap, slong *innovation)
+{
+	ulong difference;
+	uchar negative;
+
+	// Unsigned difference does not overflow with opposite signs
+	negative = measurement < prediction;
+	difference = negative ? (ulong) prediction - (ulong) measurement : (ulong) measurement - (ulong) prediction;
+
+	if(wrap && difference > wrap / 2)
+	{
+		difference = wrap - difference;
+		negative = !negative;
+	}
+
+	if(difference > (ulong) GPS_FILTER_MAX_JUMP)
+	{
+		return 0;
+	}
+
+	*innovation = negative ? -(slong) difference : (slong) difference;
+
+	return 1;
+}
+
+/**
+ * @brief Wrap a Longitude into -180 to 180 Degrees
+ * @param longitude Longitude, 1e-7 Degrees, less than 180 Degrees out of range
+ * @return Longitude, 1e-7 Degrees
+ */
+slong gpsFilterWrapLongitude(slong longitude)
+{
+	// Half turn twice, a full turn does not fit in slong
+	if(longitude > 180 * GPS_COORDINATE_SCALE)
+	{
+		return longitude - 180 * GPS_COORDINATE_SCALE - 180 * GPS_COORDINATE_SCALE;
+	}
+
+	if(longitude < -180 * GPS_COORDINATE_SCALE)
+	{
+		return longitude + 180 * GPS_COORDINATE_SCALE + 180 * GPS_COORDINATE_SCALE;
+	}
+
+	return longitude;
+}
+
+/**
+ * @brief Restart the Filter at the Position of the GPS Fix, the fix is taken without smoothing
+ * @param fix GPS Fix
+ */
+void gpsFilterRestart(const gpsStructNmeaGPRMC *fix)
+{
+	gpsFilterLatitude = (*fix).latitude;
+	gpsFilterLongitude = (*fix).longitude;
+	gpsFilterLatitudeRate = 0;
+	gpsFilterLongitudeRate = 0;
+	gpsFilterEpoch = (*fix).epoch;
+	gpsFilterValid = 1;
+}
+
+/**
+ * @brief Filter the Position of the GPS Fix, called by gpsPublishFix with GPS_FILTER
+ * Steady-state Kalman gains (alpha-beta) from HDOP and speed, one step per fix, integer only
+ * @param fix GPS Fix, latitude and longitude are replaced by the filtered position
+ * @return 1 --> Filtered or restarted after a gap, 0 --> Restarted after a jump larger than GPS_FILTER_MAX_JUMP
+ */
+uchar gpsFilterUpdate(gpsStructNmeaGPRMC *fix)
+{
+	slong predictionLatitude;
+	slong predictionLongitude;
+	slong innovationLatitude;
+	slong innovationLongitude;
+	uchar stationary;
+	uchar index;
+	uint hdop;
+
+	// Receiver Doppler speed below the odometer threshold, velocity is zero
+	stationary = (*fix).speedOverGround < GPS_ODOMETER_MIN_SPEED;
+
+	if(stationary)
+	{
+		gpsFilterLatitudeRate = 0;
+		gpsFilterLongitudeRate = 0;
+	}
+
+	// Prediction with constant velocity
+	predictionLatitude = gpsFilterLatitude + gpsFilterLatitudeRate;
+	predictionLongitude = gpsFilterWrapLongitude(gpsFilterLongitude + gpsFilterLongitudeRate);
+
+	// Restart after a gap (hibernate), the receiver moved in between
+	if(!gpsFilterValid || (*fix).epoch - gpsFilterEpoch > GPS_FILTER_MAX_GAP)
+	{
+		gpsFilterRestart(fix);
+		return 1;
+	}
+
+	// Restart after a jump (reacquisition, 180 Degrees of longitude), the segment was not travelled
+	if(!gpsFilterInnovation((*fix).latitude, predictionLatitude, 0, &innovationLatitude)
+		|| !gpsFilterInnovation((*fix).longitude, predictionLongitude, GPS_FILTER_FULL_TURN, &innovationLongitude))
+	{
+		gpsFilterRestart(fix);
+		return 0;
+	}
+
+	gpsFilterEpoch = (*fix).epoch;
+
+	// Gains by HDOP, 2.0 if no GGA was received
+	hdop = (*fix).quality.hdop ? (*fix).quality.hdop : 200;
+	index = hdop / 50 < GPS_FILTER_QTY_GAINS ? (uchar) (hdop / 50) : GPS_FILTER_QTY_GAINS - 1;
+
+	// Correction
+	gpsFilterLatitude = predictionLatitude + gpsFilterGain(innovationLatitude, gpsFilterAlpha[stationary][index]);
+	gpsFilterLongitude = gpsFilterWrapLongitude(predictionLongitude + gpsFilterGain(innovationLongitude, gpsFilterAlpha[stationary][index]));
+	gpsFilterLatitudeRate += gpsFilterGain(innovationLatitude, gpsFilterBeta[stationary][index]);
+	gpsFilterLongitudeRate += gpsFilterGain(innovationLongitude, gpsFilterBeta[stationary][index]);
+
+	(*fix).latitude = gpsFilterLatitude;
+	(*fix).longitude = gpsFilterLongitude;
+
+	return 1;
+}
+
+/**
+ * @brief Get Filtered Velocity
+ * @param latitudeRate North Velocity, 1e-7 Degrees per fix
+ * @param longitudeRate East Velocity, 1e-7 Degrees per fix
+ */
+void gpsFilterGetVelocity(slong *latitudeRate, slong *longitudeRate)
+{
+	*latitudeRate = gpsFilterLatitudeRate;
+	*longitudeRate = gpsFilterLongitudeRate;
+}
@@ -0,0 +1,340 @@
+/**
+ *  @file gpsPower.c
+ *  @brief Module that Duty-Cycles the GPS Receiver between Fixes
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gpsPower.h"
+
+/**
+ * GPS Power State
+ */
+uchar gpsPowerCurrentState;
+
+/**
+ * System Tick when the current state was entered
+ */
+ulong gpsPowerStateTick;
+
+/**
+ * Hibernate Time in System Ticks
+ */
+ulong gpsPowerSleepTicks;
+
+/**
+ * System Tick when the receiver was confirmed awake
+ */
+ulong gpsPowerAwakeTick;
+
+/**
+ * System Tick the fix wait started, the wake up or the last settled fix when staying awake
+ */
+ulong gpsPowerAcquireTick;
+
+/**
+ * System Tick of the settled fix
+ */
+ulong gpsPowerFixTick;
+
+/**
+ * System Tick of the last Ephemeris Refresh
+ */
+ulong gpsPowerEphemerisTick;
+
+/**
+ * Ephemeris Refresh in progress in this wake up
+ */
+uchar gpsPowerRefresh;
+
+/**
+ * Sequence of the last GPS Fix seen
+ */
+ulong gpsPowerSequence;
+
+/**
+ * New Fixes since the wake up
+ */
+uchar gpsPowerQtyFixes;
+
+/**
+ * Fix Interval in Seconds
+ */
+uint gpsPowerFixInterval;
+
+/**
+ * GPS Power Statistics
+ */
+gpsStructPowerStats gpsPowerStats;
+
+/**
+ * @brief Change GPS Power State
+ * @param state New State
+ * @param tick Current System Tick
+ */
+void gpsPowerSetState(uchar state, ulong tick)
+{
+	gpsPowerCurrentState = state;
+	gpsPowerStateTick = tick;
+}
+
+/**
+ * @brief Receiver Awake, wait for the settled fix
+ * @param tick Current System Tick
+ */
+void gpsPowerStartAcquire(ulong tick)
+{
+	gpsPowerAwakeTick = tick;
+	gpsPowerAcquireTick = tick;
+	gpsPowerQtyFixes = 0;
+
+	// Receiver tracks long enough to decode new ephemeris
+	gpsPowerRefresh = tick - gpsPowerEphemerisTick >= GPS_POWER_SECONDS(GPS_POWER_EPHEMERIS_PERIOD);
+
+	gpsPowerSetState(GPS_POWER_ACQUIRE, tick);
+}
+
+/**
+ * @brief Start Hibernate, GPS_ON_OFF pulse without blocking
+ * @param tick Current System Tick
+ */
+void gpsPowerStartSleep(ulong tick)
+{
+	ioDigitalWrite(GPS_ON_OFF,ON);
+	gpsPowerSetState(GPS_POWER_SLEEP_PULSE, tick);
+}
+
+/**
+ * @brief Fix Interval from Speed, GPS_POWER_DISTANCE between fixes
+ * @param speed Speed Over Ground, 0.01 Knots
+ * @return Seconds between Fixes
+ */
+uint gpsPowerSpeedInterval(uint speed)
+{
+	ulong interval;
+
+	// Stationary
+	if(speed < GPS_ODOMETER_MIN_SPEED)
+	{
+		return GPS_POWER_MAX_INTERVAL;
+	}
+
+	// 0.01 Knots = 0.00514444 m/s, Meters * 194.384 / Speed
+	interval = (ulong) GPS_POWER_DISTANCE * 194384UL / ((ulong) speed * 1000UL);
+
+	if(interval < GPS_POWER_MIN_INTERVAL)
+	{
+		return GPS_POWER_MIN_INTERVAL;
+	}
+
+	if(interval > GPS_POWER_MAX_INTERVAL)
+	{
+		return GPS_POWER_MAX_INTERVAL;
+	}
+
+	return (uint) interval;
+}
+
+/**
+ * @brief GPS Power Init, call after gpsInit, the receiver stays awake until the first fix
+ */
+void gpsPowerInit()
+{
+	gpsStructNmeaGPRMC fix;
+	ulong tick;
+
+	gpsPowerStats.wakeUps = 0;
+	gpsPowerStats.wakeTimeouts = 0;
+	gpsPowerStats.fixTimeouts = 0;
+	gpsPowerStats.awakeTicks = 0;
+
+	gpsPowerFixInterval = GPS_POWER_MIN_INTERVAL;
+
+	// Only fixes published from now are counted
+	gpsGetFix(&fix);
+	gpsPowerSequence = fix.sequence;
+
+	tick = timerGetTick();
+
+	// First wake up after power on downloads the ephemeris
+	gpsPowerEphemerisTick = tick - GPS_POWER_SECONDS(GPS_POWER_EPHEMERIS_PERIOD);
+
+	if(gpsAwake())
+	{
+		gpsPowerStartAcquire(tick);
+	}
+	else
+	{
+		// Wake up now
+		gpsPowerSleepTicks = 0;
+		gpsPowerSetState(GPS_POWER_HIBERNATE, tick);
+	}
+}
+
+/**
+ * @brief GPS Power Scheduler, call from the main loop after gpsProcess, does not block
+ * Hibernates the receiver after GPS_POWER_SETTLE_FIXES and wakes it GPS_POWER_HOT_START before the next fix
+ */
+void gpsPowerProcess()
+{
+	gpsStructNmeaGPRMC fix;
+	ulong tick;
+	ulong elapsed;
+	ulong wait;
+
+	tick = timerGetTick();
+	elapsed = tick - gpsPowerStateTick;
+
+	switch(gpsPowerCurrentState)
+	{
+		// Hibernate until the hot start of the next fix
+		case GPS_POWER_HIBERNATE:
+			if(elapsed >= gpsPowerSleepTicks)
+			{
+				ioDigitalWrite(GPS_ON_OFF,ON);
+				gpsPowerSetState(GPS_POWER_WAKE_PULSE, tick);
+			}
+			break;
+		case GPS_POWER_WAKE_PULSE:
+			if(elapsed >= GPS_POWER_MS(GPS_ON_OFF_PULSE))
+			{
+				ioDigitalWrite(GPS_ON_OFF,OFF);
+				gpsPowerSetState(GPS_POWER_WAKING, tick);
+			}
+			break;
+		// Wake Up confirmed by GPS_WAKE
+		case GPS_POWER_WAKING:
+			if(gpsAwake())
+			{
+				gpsPowerStats.wakeUps++;
+				gpsPowerStartAcquire(tick);
+			}
+			else if(elapsed >= GPS_POWER_MS(GPS_WAKE_TIMEOUT))
+			{
+				// Pulse not taken, try again after the minimum interval
+				gpsPowerStats.wakeTimeouts++;
+				gpsPowerSleepTicks = GPS_POWER_SECONDS(GPS_POWER_MIN_INTERVAL);
+				gpsPowerSetState(GPS_POWER_HIBERNATE, tick);
+			}
+			break;
+		// Awake, count the new fixes until the position is settled
+		case GPS_POWER_ACQUIRE:
+			gpsGetFix(&fix);
+
+			if(fix.sequence != gpsPowerSequence)
+			{
+				gpsPowerSequence = fix.sequence;
+
+				// Next interval from the speed of the settled fix
+				if(gpsPowerQtyFixes < GPS_POWER_SETTLE_FIXES && ++gpsPowerQtyFixes == GPS_POWER_SETTLE_FIXES)
+				{
+					gpsPowerFixTick = tick;
+					gpsPowerFixInterval = gpsPowerSpeedInterval(fix.speedOverGround);
+				}
+			}
+
+			if(gpsPowerQtyFixes < GPS_POWER_SETTLE_FIXES)
+			{
+				// No sky view, hibernate until the next interval
+				if(tick - gpsPowerAcquireTick >= GPS_POWER_SECONDS(GPS_POWER_FIX_TIMEOUT))
+				{
+					gpsPowerStats.fixTimeouts++;
+					gpsPowerSleepTicks = GPS_POWER_SECONDS(gpsPowerFixInterval);
+					gpsPowerStartSleep(tick);
+				}
+				break;
+			}
+
+			// Ephemeris Refresh keeps the receiver tracking
+			if(gpsPowerRefresh)
+			{
+				if(tick - gpsPowerFixTick < GPS_POWER_SECONDS(GPS_POWER_EPHEMERIS_TIME))
+				{
+					break;
+				}
+
+				gpsPowerRefresh = 0;
+				gpsPowerEphemerisTick = tick;
+			}
+
+			// Hibernate shorter than GPS_POWER_MIN_HIBERNATE after the hot start and settle time, stay awake and check the next fix
+			if(gpsPowerFixInterval < GPS_POWER_HOT_START + GPS_POWER_SETTLE_FIXES + GPS_POWER_MIN_HIBERNATE)
+			{
+				gpsPowerAcquireTick = tick;
+				gpsPowerQtyFixes = GPS_POWER_SETTLE_FIXES - 1;
+				break;
+			}
+
+			// Wake Up before the next fix by the hot start and settle time
+			wait = GPS_POWER_SECONDS(gpsPowerFixInterval - GPS_POWER_HOT_START - GPS_POWER_SETTLE_FIXES);
+			elapsed = tick - gpsPowerFixTick;
+			gpsPowerSleepTicks = wait > elapsed ? wait - elapsed : 0;
+			gpsPowerStartSleep(tick);
+			break;
+		case GPS_POWER_SLEEP_PULSE:
+			if(elapsed >= GPS_POWER_MS(GPS_ON_OFF_PULSE))
+			{
+				ioDigitalWrite(GPS_ON_OFF,OFF);
+				gpsPowerSetState(GPS_POWER_SLEEPING, tick);
+			}
+			break;
+		// Hibernate confirmed by GPS_WAKE
+		case GPS_POWER_SLEEPING:
+			if(!gpsAwake())
+			{
+				gpsPowerStats.awakeTicks += tick - gpsPowerAwakeTick;
+				gpsPowerSetState(GPS_POWER_HIBERNATE, tick);
+			}
+			else if(elapsed >= GPS_POWER_MS(GPS_WAKE_TIMEOUT))
+			{
+				// Pulse not taken, still awake, try again after the next settled fix
+				gpsPowerStats.wakeTimeouts++;
+				gpsPowerStats.awakeTicks += tick - gpsPowerAwakeTick;
+				gpsPowerStartAcquire(tick);
+			}
+			break;
+	}
+}
+
+/**
+ * @brief Get GPS Power State
+ * @return GPS_POWER_HIBERNATE, ..., GPS_POWER_SLEEPING
+ */
+uchar gpsPowerState()
+{
+	return gpsPowerCurrentState;
+}
+
+/**
+ * @brief Get Fix Interval from the last fix speed
+ * @return Seconds between Fixes
+ */
+uint gpsPowerInterval()
+{
+	return gpsPowerFixInterval;
+}
+
+/**
+ * @brief Get GPS Power Statistics
+ * @param stats Copy of the GPS Power Statistics
+ */
+void gpsPowerGetStats(gpsStructPowerStats *stats)
+{
+	*stats = gpsPowerStats;
+}
@@ -0,0 +1,249 @@
+/**
+ *  @file gpsTrack.c
+ *  @brief Module that Simplifies the GPS Track before Storage, Streaming Opening Window with Dead-Band
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gpsTrack.h"
+
+/**
+ * Tolerance in Centimeters
+ */
+ulong gpsTrackTolerance;
+
+/**
+ * Point Kept Callback
+ */
+void (*gpsTrackCallback)(const gpsStructTrackPoint *point);
+
+/**
+ * Last Point Kept, start of the segment under test
+ */
+gpsStructTrackPoint gpsTrackAnchor;
+
+/**
+ * Anchor valid, 0 --> next fix starts the track
+ */
+uchar gpsTrackStart;
+
+/**
+ * Fixes not kept yet after the anchor
+ */
+gpsStructTrackPoint gpsTrackWindow[GPS_TRACK_WINDOW];
+
+/**
+ * Quantity Fixes in the Window
+ */
+uchar gpsTrackQtyWindow;
+
+/**
+ * Sequence of the last GPS Fix added
+ */
+ulong gpsTrackSequence;
+
+/**
+ * GPS Track Statistics
+ */
+gpsStructTrackStats gpsTrackStats;
+
+/**
+ * @brief GPS Track Init, the next fix is kept as the start of the track
+ * @param tolerance Maximum distance in Centimeters from any fix to the simplified track (Ex. 1000 --> 10 m), twice for fixes dropped while stopped
+ * @param callback Function called with each point kept, store or upload it there
+ */
+void gpsTrackInit(ulong tolerance, void (*callback)(const gpsStructTrackPoint *point))
+{
+	gpsTrackTolerance = tolerance;
+	gpsTrackCallback = callback;
+	gpsTrackStart = 0;
+	gpsTrackQtyWindow = 0;
+	gpsTrackStats.fixes = 0;
+	gpsTrackStats.points = 0;
+
+	// Sequence 0 is never published
+	gpsTrackSequence = 0;
+}
+
+/**
+ * @brief Keep a Point, it becomes the anchor of the next segment
+ * @param point Point
+ */
+void gpsTrackKeep(const gpsStructTrackPoint *point)
+{
+	gpsTrackAnchor = *point;
+	gpsTrackStart = 1;
+	gpsTrackStats.points++;
+
+	if(gpsTrackCallback)
+	{
+		gpsTrackCallback(&gpsTrackAnchor);
+	}
+}
+
+/**
+ * @brief Distance from a Point to a Segment that starts at the origin, offsets from distanceOffset
+ * @param north North Offset of the Point in Centimeters
+ * @param east East Offset of the Point in Centimeters
+ * @param endNorth North Offset of the Segment End in Centimeters
+ * @param endEast East Offset of the Segment End in Centimeters
+ * @return Distance in Centimeters, resolved to the largest offset / 16384
+ */
+ulong gpsTrackDistance(slong north, slong east, slong endNorth, slong endEast)
+{
+	slong scaledNorth;
+	slong scaledEast;
+	slong scaledEndNorth;
+	slong scaledEndEast;
+	slong dot;
+	slong length;
+	ulong cross;
+	uchar shift;
+
+	// Scale so that the products fit in 32 bits
+	shift = distanceScaleShift(distanceAbs(north) | distanceAbs(east) | distanceAbs(endNorth) | distanceAbs(endEast));
+	scaledNorth = distanceScaleDown(north, shift);
+	scaledEast = distanceScaleDown(east, shift);
+	scaledEndNorth = distanceScaleDown(endNorth, shift);
+	scaledEndEast = distanceScaleDown(endEast, shift);
+
+	// Projection of the point on the segment, before the start or after the end the nearest end is the closest point
+	dot = scaledNorth * scaledEndNorth + scaledEast * scaledEndEast;
+	length = scaledEndNorth * scaledEndNorth + scaledEndEast * scaledEndEast;
+
+	if(dot <= 0)
+	{
+		return distanceHypot(distanceAbs(north), distanceAbs(east));
+	}
+
+	if(dot >= length)
+	{
+		return distanceHypot(distanceAbs(north - endNorth), distanceAbs(east - endEast));
+	}
+
+	// Cross-Track Distance, |cross product| / segment length
+	cross = distanceAbs(scaledNorth * scaledEndEast - scaledEast * scaledEndNorth);
+
+	return (cross / distanceHypot(distanceAbs(scaledEndNorth), distanceAbs(scaledEndEast))) << shift;
+}
+
+/**
+ * @brief Add the GPS Fix to the Track, call from the main loop
+ * A fix already added (same sequence) is ignored, a fix within the tolerance of the last fix is dropped (stopped),
+ * it stays within twice the tolerance of the track
+ * @param fix GPS Fix from gpsGetFix
+ * @return Quantity Points kept
+ */
+uchar gpsTrackUpdate(const gpsStructNmeaGPRMC *fix)
+{
+	gpsStructTrackPoint point;
+	slong north;
+	slong east;
+	slong endNorth;
+	slong endEast;
+	uchar i;
+
+	// No fix yet or fix already added
+	if((*fix).sequence == gpsTrackSequence)
+	{
+		return 0;
+	}
+
+	gpsTrackSequence = (*fix).sequence;
+	gpsTrackStats.fixes++;
+
+	point.latitude = (*fix).latitude;
+	point.longitude = (*fix).longitude;
+	point.epoch = (*fix).epoch;
+
+	// First fix starts the track
+	if(!gpsTrackStart)
+	{
+		gpsTrackKeep(&point);
+		return 1;
+	}
+
+	distanceOffset(gpsTrackAnchor.latitude, gpsTrackAnchor.longitude, point.latitude, point.longitude, &endNorth, &endEast);
+
+	// Dead-Band, a fix close to the last fix waiting (the anchor if none) adds nothing to the track (stopped), dropped
+	if(gpsTrackQtyWindow)
+	{
+		distanceOffset(gpsTrackWindow[gpsTrackQtyWindow - 1].latitude, gpsTrackWindow[gpsTrackQtyWindow - 1].longitude, point.latitude, point.longitude, &north, &east);
+	}
+	else
+	{
+		north = endNorth;
+		east = endEast;
+	}
+
+	if(distanceHypot(distanceAbs(north), distanceAbs(east)) <= gpsTrackTolerance)
+	{
+		return 0;
+	}
+
+	// Opening Window, the fixes waiting must stay close to the segment from the anchor to the new fix
+	for(i = 0; i < gpsTrackQtyWindow; i++)
+	{
+		distanceOffset(gpsTrackAnchor.latitude, gpsTrackAnchor.longitude, gpsTrackWindow[i].latitude, gpsTrackWindow[i].longitude, &north, &east);
+
+		if(gpsTrackDistance(north, east, endNorth, endEast) > gpsTrackTolerance)
+		{
+			break;
+		}
+	}
+
+	// Keep the last fix that closed a valid segment and open a new window with the new fix
+	if(i < gpsTrackQtyWindow || gpsTrackQtyWindow == GPS_TRACK_WINDOW)
+	{
+		gpsTrackKeep(&gpsTrackWindow[gpsTrackQtyWindow - 1]);
+		gpsTrackWindow[0] = point;
+		gpsTrackQtyWindow = 1;
+		return 1;
+	}
+
+	gpsTrackWindow[gpsTrackQtyWindow++] = point;
+
+	return 0;
+}
+
+/**
+ * @brief Keep the last fix waiting in the window, call at the end of the trip or before powering off
+ * @return Quantity Points kept
+ */
+uchar gpsTrackFlush()
+{
+	if(gpsTrackQtyWindow == 0)
+	{
+		return 0;
+	}
+
+	gpsTrackKeep(&gpsTrackWindow[gpsTrackQtyWindow - 1]);
+	gpsTrackQtyWindow = 0;
+
+	return 1;
+}
+
+/**
+ * @brief Get GPS Track Statistics
+ * @param stats Copy of the GPS Track Statistics
+ */
+void gpsTrackGetStats(gpsStructTrackStats *stats)
+{
+	*stats = gpsTrackStats;
+}
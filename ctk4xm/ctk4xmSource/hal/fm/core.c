@@ -104,6 +104,34 @@ void _hal_coreDisableInterrupts()
 	asm(sei);
 }
 
+/**
+ * @brief Disable Interrupts and return the previous state
+ * @return 1 --> Interrupts were enabled (CCR I bit clear), 0 --> Disabled
+ */
+uchar _hal_coreSaveInterrupts()
+{
+	uchar ccr;
+
+	// Condition Code Register to A
+	asm(tpa);
+	asm(sta ccr);
+	asm(sei);
+
+	return !(ccr & 0x08);
+}
+
+/**
+ * @brief Restore the Interrupt State returned by _hal_coreSaveInterrupts
+ * @param state Interrupt State
+ */
+void _hal_coreRestoreInterrupts(uchar state)
+{
+	if(state)
+	{
+		asm(cli);
+	}
+}
+
 /**
  * @brief Entry Low Power Mode
  */
@@ -72,4 +72,22 @@ void _hal_timerStop()
 
 }
 
+/**
+ * @brief Get Timer Counter
+ * @return Timer Counter, 0 to Period - 1
+ */
+uint _hal_timerGetCount()
+{
+	return TPM1CNT;
+}
+
+/**
+ * @brief Get Timer Period
+ * @return Timer Counts per Timer Interrupt
+ */
+uint _hal_timerGetPeriod()
+{
+	return TPM1MOD + 1;
+}
+
 #endif
@@ -22,6 +22,7 @@
  */
 
 #include "hal/uart.h"
+#include "io.h"
 
 #ifdef FREESCALE
 
@@ -39,86 +40,219 @@
 #define	SC2_BDH			(SC2_BR & 0xFF00) >> 8
 #define	SC2_BDL			SC2_BR & 0x00FF
 
+//				SCIx
+//				----
+//	SCIxBDH		Base + 0
+//	SCIxBDL		Base + 1
+//	SCIxC1		Base + 2
+//	SCIxC2		Base + 3
+//	SCIxS1		Base + 4
+//	SCIxS2		Base + 5
+//	SCIxC3		Base + 6
+//	SCIxD		Base + 7
+
+/**
+ * SCIxBDH to SCIxBDL Register Offset
+ */
+const uchar OFFSET_SCIxBDH_SCIxBDL = 1;
+
+/**
+ * SCIxBDH to SCIxC2 Register Offset
+ */
+const uchar OFFSET_SCIxBDH_SCIxC2 = 3;
+
+/**
+ * SCIxBDH to SCIxS1 Register Offset
+ */
+const uchar OFFSET_SCIxBDH_SCIxS1 = 4;
+
+/**
+ * SCIxBDH to SCIxC3 Register Offset
+ */
+const uchar OFFSET_SCIxBDH_SCIxC3 = 6;
+
+/**
+ * SCIxBDH to SCIxD Register Offset
+ */
+const uchar OFFSET_SCIxBDH_SCIxD = 7;
+
 /**
  * @brief Init UART Module
  * @param uartId UART Id
+ * @return UART Register Base, 0 if uartId is not valid
  * UART1 --> PTE0 (RX), PTE1 (TX)
  * UART2 --> PTC0 (RX), PTC1 (TX)
  */
-void _hal_uartInit(uchar uartId)
+vuchar * _hal_uartInit(uchar uartId)
 {
+	vuchar *uartRegister;
+
 	// Configure SCI Pins
 	switch(uartId)
 	{
 		case 1:
 			ioDigitalOutput(SCI1_TX);
 			ioDigitalInput(SCI1_RX);
-			SCI1BDH = SC1_BDH;
-			SCI1BDL = SC1_BDL;
+			uartRegister = &SCI1BDH;
+			*uartRegister = SC1_BDH;
+			*(uartRegister + OFFSET_SCIxBDH_SCIxBDL) = SC1_BDL;
 			break;
 		case 2:
 			ioDigitalOutput(SCI2_TX);
 			ioDigitalInput(SCI2_RX);
-			SCI2BDH = SC2_BDH;
-			SCI2BDL = SC2_BDL;
+			uartRegister = &SCI2BDH;
+			*uartRegister = SC2_BDH;
+			*(uartRegister + OFFSET_SCIxBDH_SCIxBDL) = SC2_BDL;
  			break;
+		default:
+			return 0;
 	}
 
 	// Enabled RX and TX
-	SCI1C2 = SCI1C2_TE_MASK | SCI1C2_RE_MASK;
+	*(uartRegister + OFFSET_SCIxBDH_SCIxC2) = SCI1C2_TE_MASK | SCI1C2_RE_MASK;
+
+	return uartRegister;
 }
 
 /**
  * @brief Read Byte UART
+ * @param uartRegister UART Register Base
  */
-uchar _hal_uartReadByte()
+uchar _hal_uartReadByte(vuchar *uartRegister)
 {
 	// Wait for Reception Complete
-	while(!(SCI1S1 & SCI1S1_RDRF_MASK));
+	while(!(*(uartRegister + OFFSET_SCIxBDH_SCIxS1) & SCI1S1_RDRF_MASK));
 
-	return SCI1D;
+	return *(uartRegister + OFFSET_SCIxBDH_SCIxD);
+}
+
+/**
+ * @brief Read Received Byte and Error Flags without blocking, clears the flags
+ * @param uartRegister UART Register Base
+ * @param readByte Received Byte
+ * @return Receive Status, UART_RX_DATA if readByte is valid
+ */
+uchar _hal_uartReceiveData(vuchar *uartRegister, uchar *readByte)
+{
+	uchar statusRegister;
+	uchar status;
+
+	statusRegister = *(uartRegister + OFFSET_SCIxBDH_SCIxS1);
+
+	if(!(statusRegister & (SCI1S1_RDRF_MASK | SCI1S1_IDLE_MASK | SCI1S1_OR_MASK | SCI1S1_NF_MASK | SCI1S1_FE_MASK | SCI1S1_PF_MASK)))
+	{
+		return 0;
+	}
+
+	// Read Data Register to clear RDRF, IDLE and Error Flags
+	*readByte = *(uartRegister + OFFSET_SCIxBDH_SCIxD);
+	status = 0;
+
+	// Received Byte is still valid with Noise or Overrun, Overrun byte is lost
+	if(statusRegister & SCI1S1_OR_MASK)
+	{
+		status |= UART_RX_OVERRUN;
+	}
+	if(statusRegister & SCI1S1_NF_MASK)
+	{
+		status |= UART_RX_NOISE;
+	}
+	if(statusRegister & SCI1S1_FE_MASK)
+	{
+		status |= UART_RX_FRAMING;
+	}
+	if(statusRegister & SCI1S1_PF_MASK)
+	{
+		status |= UART_RX_PARITY;
+	}
+	if(statusRegister & SCI1S1_IDLE_MASK)
+	{
+		status |= UART_RX_IDLE;
+	}
+	if((statusRegister & SCI1S1_RDRF_MASK) && !(statusRegister & (SCI1S1_FE_MASK | SCI1S1_PF_MASK)))
+	{
+		status |= UART_RX_DATA;
+	}
+
+	return status;
 }
 
 /**
  * @brief Write Byte UART
+ * @param uartRegister UART Register Base
  * @param writeByte Byte to Write
  */
-void _hal_uartWriteByte(uchar writeByte)
+void _hal_uartWriteByte(vuchar *uartRegister, uchar writeByte)
 {
+	// Wait for Transmit Data Register Empty
+	while(!(*(uartRegister + OFFSET_SCIxBDH_SCIxS1) & SCI1S1_TDRE_MASK));
+
 	// Write Byte to Send
-	SCI1D = writeByte;
+	*(uartRegister + OFFSET_SCIxBDH_SCIxD) = writeByte;
 
 	// Wait for Transmit Complete
-	while(!(SCI1S1 & SCI1S1_TC_MASK));
+	while(!(*(uartRegister + OFFSET_SCIxBDH_SCIxS1) & SCI1S1_TC_MASK));
+}
+
+/**
+ * @brief Test if the Transmitter can accept the next byte, called from TX ISR
+ * @param uartRegister UART Register Base
+ * @return 1 if the next byte can be written, 0 otherwise
+ */
+uchar _hal_uartTransmitReady(vuchar *uartRegister)
+{
+	// TX ISR is only requested with Transmit Data Register Empty
+	return 1;
+}
+
+/**
+ * @brief Write Byte to Transmit Data Register without blocking
+ * @param uartRegister UART Register Base
+ * @param writeByte Byte to Write
+ */
+void _hal_uartTransmitData(vuchar *uartRegister, uchar writeByte)
+{
+	// Read Status and Write Data Registers to clear TDRE Flag
+	(void) *(uartRegister + OFFSET_SCIxBDH_SCIxS1);
+	*(uartRegister + OFFSET_SCIxBDH_SCIxD) = writeByte;
 }
 
 /**
  * @brief Read Interrupt Enable/Disable
+ * @param uartRegister UART Register Base
+ * @param state Enabled or Disabled
  */
-void _hal_uartReadInterrupt(uchar state)
+void _hal_uartReadInterrupt(vuchar *uartRegister, uchar state)
 {
+	// Receive and Idle Line --> SCIx RX ISR, Overrun, Noise, Framing and Parity --> SCIx ERR ISR
 	if(state)
 	{
-		SCI1C2 |= SCI1C2_RIE_MASK;
+		*(uartRegister + OFFSET_SCIxBDH_SCIxC3) |= SCI1C3_ORIE_MASK | SCI1C3_NEIE_MASK | SCI1C3_FEIE_MASK | SCI1C3_PEIE_MASK;
+		*(uartRegister + OFFSET_SCIxBDH_SCIxC2) |= SCI1C2_RIE_MASK | SCI1C2_ILIE_MASK;
 	}
 	else
 	{
-		SCI1C2 &= ~(SCI1C2_RIE_MASK);
+		*(uartRegister + OFFSET_SCIxBDH_SCIxC2) &= ~(SCI1C2_RIE_MASK | SCI1C2_ILIE_MASK);
+		*(uartRegister + OFFSET_SCIxBDH_SCIxC3) &= ~(SCI1C3_ORIE_MASK | SCI1C3_NEIE_MASK | SCI1C3_FEIE_MASK | SCI1C3_PEIE_MASK);
 	}
 }
 
 /**
- * @brief Write Interrupt Enable/Disable
+ * @brief Write Interrupt (Transmit Data Register Empty) Enable/Disable
+ * @param uartRegister UART Register Base
+ * @param state Enabled or Disabled
  */
-void _hal_uartWriteInterrupt(uchar state)
+void _hal_uartWriteInterrupt(vuchar *uartRegister, uchar state)
 {
+	uartRegister += OFFSET_SCIxBDH_SCIxC2;
+
 	if(state)
 	{
-		SCI1C2 |= SCI1C2_TCIE_MASK;
+		*uartRegister |= SCI1C2_TIE_MASK;
 	}
 	else
 	{
-		SCI1C2 &= ~(SCI1C2_TCIE_MASK);
+		*uartRegister &= ~(SCI1C2_TIE_MASK);
 	}
 }
 
@@ -0,0 +1,105 @@
+/**
+ *  @file core.c
+ *  @brief General CTK4XM API Specifications - Host Workstation
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "hal/core.h"
+
+#ifdef HOST
+
+/**
+ * @brief Select Internal Clock
+ * @param frequencyMHz MCU Frequency in MHz
+ */
+void _hal_coreSelectInternalClock(uchar frequencyMHz)
+{
+
+}
+
+/**
+ * @brief Select External Clock
+ */
+void _hal_coreSelectExternalClock()
+{
+
+}
+
+/**
+ * @brief Stop Watchdog Timer
+ */
+void _hal_coreStopWatchdogTimer()
+{
+
+}
+
+/**
+ * Host Interrupt State, the host has no interrupts, kept for coreSaveInterrupts
+ */
+uchar hostInterruptState;
+
+/**
+ * @brief Enable Interrupts, the host has no interrupts, ISR handlers are called from the application loop
+ */
+void _hal_coreEnableInterrupts()
+{
+	hostInterruptState = 1;
+}
+
+/**
+ * @brief Disable Interrupts
+ */
+void _hal_coreDisableInterrupts()
+{
+	hostInterruptState = 0;
+}
+
+/**
+ * @brief Disable Interrupts and return the previous state
+ * @return 1 --> Interrupts were enabled, 0 --> Disabled
+ */
+uchar _hal_coreSaveInterrupts()
+{
+	uchar state;
+
+	state = hostInterruptState;
+	hostInterruptState = 0;
+
+	return state;
+}
+
+/**
+ * @brief Restore the Interrupt State returned by _hal_coreSaveInterrupts
+ * @param state Interrupt State
+ */
+void _hal_coreRestoreInterrupts(uchar state)
+{
+	hostInterruptState = state;
+}
+
+/**
+ * @brief Entry Low Power Mode
+ */
+void _hal_coreEntryLowPowerMode()
+{
+
+}
+
+#endif
@@ -0,0 +1,259 @@
+/**
+ *  @file io.c
+ *  @brief Module that controls the I/O pins - Host Workstation
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "hal/io.h"
+
+#ifdef HOST
+
+//				Offset
+//				------
+// 	PxIN/PxOUT	0
+//	PxDIR		1
+//	PxREN		2
+//	PxSEL		3
+//	PxIE		4
+//	PxIES		5
+//	PxIFG		6
+
+/**
+ * Host Simulated Port 1, Output Latch is read back as Input
+ */
+volatile unsigned char hostPort1[8];
+
+/**
+ * Host Simulated Port 2
+ */
+volatile unsigned char hostPort2[8];
+
+/**
+ * Px to PxDIR Register Offset
+ */
+const uchar OFFSET_Px_PxDIR = 1;
+
+/**
+ * Px to PxREN Register Offset
+ */
+const uchar OFFSET_Px_PxREN = 2;
+
+/**
+ * Px to PxSEL Register Offset
+ */
+const uchar OFFSET_Px_PxSEL = 3;
+
+/**
+ * Px to PxIE Register Offset
+ */
+const uchar OFFSET_Px_PxIE = 4;
+
+/**
+ * Px to PxIES Register Offset
+ */
+const uchar OFFSET_Px_PxIES = 5;
+
+/**
+ * Px to PxIFG Register Offset
+ */
+const uchar OFFSET_Px_PxIFG = 6;
+
+/**
+ * @brief Configure Digital Output Pin
+ * @param portDirection Port
+ * @param pinMask Pin
+ */
+void _hal_ioDigitalOutput(vuchar *portDirection, uchar pinMask)
+{
+	portDirection += OFFSET_Px_PxDIR;
+	*portDirection |= pinMask;
+}
+
+/**
+ * @brief Configure Digital Input Pin
+ * @param portDirection Port
+ * @param pinMask Pin
+ */
+void _hal_ioDigitalInput(vuchar *portDirection, uchar pinMask)
+{
+	portDirection += OFFSET_Px_PxDIR;
+	*portDirection &= ~(pinMask);
+}
+
+/**
+ * @brief Read Digital Pin
+ * @param port Port
+ * @param pinMask Pin
+ * @return Value Digital Read
+ */
+uchar _hal_ioDigitalRead(vuchar *port, uchar pinMask)
+{
+	return (*port & pinMask) != 0;
+}
+
+/**
+ * @brief Write Digital Pin
+ * @param port Port
+ * @param pinMask Pin
+ * @param level Level Pin
+ */
+void _hal_ioDigitalWrite(vuchar *port, uchar pinMask, uchar level)
+{
+	switch(level)
+	{
+		// OFF Pin
+		case 0:
+			*port &= ~(pinMask);
+			break;
+		// ON Pin
+		case 1:
+			*port |= pinMask;
+			break;
+		// Toggle Pin
+		case 2:
+			*port ^= pinMask;
+			break;
+	}
+}
+
+/**
+ * @brief Pull-Up Pin Configuration
+ * @param portDirection Port
+ * @param pinMask Pin
+ * @param state Enabled or Disabled
+ */
+void _hal_ioDigitalPullUp(vuchar *portDirection, uchar pinMask, uchar state)
+{
+	if(state)
+	{
+		// Pulled Input reads High
+		*portDirection |= pinMask;
+		*(portDirection + OFFSET_Px_PxREN) |= pinMask;
+	}
+	else
+	{
+		*(portDirection + OFFSET_Px_PxREN) &= ~(pinMask);
+	}
+}
+
+/**
+ * @brief Pull-Down Pin Configuration
+ * @param portDirection Port
+ * @param pinMask Pin
+ * @param state Enabled or Disabled
+ */
+void _hal_ioDigitalPullDown(vuchar *portDirection, uchar pinMask, uchar state)
+{
+	if(state)
+	{
+		// Pulled Input reads Low
+		*portDirection &= ~(pinMask);
+		*(portDirection + OFFSET_Px_PxREN) |= pinMask;
+	}
+	else
+	{
+		*(portDirection + OFFSET_Px_PxREN) &= ~(pinMask);
+	}
+}
+
+/**
+ * @brief Select I/O Function Pin
+ * @param port Port
+ * @param pinMask Pin
+ * @param function 0 Primary, 1 Secondary, 2 IO
+ */
+void _hal_ioSelectFunction(vuchar *port, uchar pinMask, uchar function)
+{
+	port += OFFSET_Px_PxSEL;
+
+	if(function == 2)
+	{
+		*port &= ~(pinMask);
+	}
+	else
+	{
+		*port |= pinMask;
+	}
+}
+
+/**
+ * @brief Interrupt Pin Configuration
+ * @param port Port
+ * @param pinMask Pin
+ * @param state Enabled or Disabled
+ */
+void _hal_ioDigitalInterrupt(vuchar *port, uchar pinMask, uchar state)
+{
+	port += OFFSET_Px_PxIE;
+
+	if(state)
+	{
+		*port |= pinMask;
+	}
+	else
+	{
+		*port &= ~(pinMask);
+	}
+}
+
+/**
+ * @brief Interrupt Transition Pin Configuration
+ * @param port Port
+ * @param pinMask Pin
+ * @param transition 0 Low to High, 1 High to Low
+ */
+void _hal_ioDigitalSelectInterruptTransition(vuchar *port, uchar pinMask, uchar transition)
+{
+	port += OFFSET_Px_PxIES;
+
+	if(transition)
+	{
+		*port |= pinMask;
+	}
+	else
+	{
+		*port &= ~(pinMask);
+	}
+}
+
+/**
+ * @brief Test Pin Pending Interrupt
+ * @param port Port
+ * @param pinMask Pin
+ * @return Value Pending Interrupt
+ */
+uint _hal_ioDigitalIsPendingInterrupt(vuchar *port, uchar pinMask)
+{
+	port += OFFSET_Px_PxIFG;
+	return (*port & pinMask) != 0;
+}
+
+/**
+ * @brief Clear Pin Pending Interrupt
+ * @param port Port
+ * @param pinMask Pin
+ */
+void _hal_ioDigitalClearPendingInterrupt(vuchar *port, uchar pinMask)
+{
+	port += OFFSET_Px_PxIFG;
+	*port &= ~(pinMask);
+}
+
+#endif
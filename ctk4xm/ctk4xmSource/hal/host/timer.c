@@ -0,0 +1,94 @@
+/**
+ *  @file timer.c
+ *  @brief Module that drive Timer - Host Workstation
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "hal/timer.h"
+
+#ifdef HOST
+
+#include <time.h>
+
+/**
+ * Host Timer Period in us, the Timer Interrupt is not generated, the application calls timerTickIncrement
+ */
+uint hostTimerPeriod = 1000;
+
+/**
+ * @brief Set Count Timer
+ * @param valueCounter Period in us
+ */
+void _hal_timerSetCount(uint valueCounter)
+{
+	hostTimerPeriod = valueCounter;
+}
+
+/**
+ * @brief Clear and Enabled Timer Interrupt
+ */
+void _hal_timerInterruptEnable()
+{
+
+}
+
+/**
+ * @brief Clear Timer Interrupt Flag
+ */
+void _hal_timerClearInterruptFlag()
+{
+
+}
+
+/**
+ * @brief Init Timer
+ */
+void _hal_timerStart()
+{
+
+}
+
+/**
+ * @brief Stop Timer
+ */
+void _hal_timerStop()
+{
+
+}
+
+/**
+ * @brief Get Timer Counter, Process CPU Time in us
+ * @return Timer Counter, 0 to Period - 1
+ */
+uint _hal_timerGetCount()
+{
+	return (uint) ((clock() * (1000000UL / CLOCKS_PER_SEC)) % hostTimerPeriod);
+}
+
+/**
+ * @brief Get Timer Period
+ * @return Timer Counts per Timer Interrupt
+ */
+uint _hal_timerGetPeriod()
+{
+	return hostTimerPeriod;
+}
+
+#endif
@@ -0,0 +1,236 @@
+/**
+ *  @file uart.c
+ *  @brief Module that allows Asynchronous Communications
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "hal/uart.h"
+
+#ifdef HOST
+
+#include <stdio.h>
+#include <poll.h>
+#include <unistd.h>
+
+//				SCIx
+//				----
+//	RIE			0
+//	TIE			1
+
+/**
+ * Host UART Registers, all ports read Standard Input (or a replay buffer) and write Standard Output
+ */
+vuchar hostUartRegister[2][2];
+
+/**
+ * SCIx to Read Interrupt Enable Register Offset
+ */
+const uchar OFFSET_SCIx_RIE = 0;
+
+/**
+ * SCIx to Write Interrupt Enable Register Offset
+ */
+const uchar OFFSET_SCIx_TIE = 1;
+
+/**
+ * Host UART Replay Buffers, received instead of Standard Input when not 0
+ */
+const uchar *hostUartReplayData[2];
+
+/**
+ * Host UART Replay Buffers, bytes left
+ */
+ulong hostUartReplayLength[2];
+
+/**
+ * @brief Init UART Module
+ * @param uartId UART Id
+ * @return UART Register Base, 0 if uartId is not valid
+ */
+vuchar * _hal_uartInit(uchar uartId)
+{
+	vuchar *uartRegister;
+
+	if(uartId < 1 || uartId > 2)
+	{
+		return 0;
+	}
+
+	uartRegister = hostUartRegister[uartId - 1];
+	*(uartRegister + OFFSET_SCIx_RIE) = 0;
+	*(uartRegister + OFFSET_SCIx_TIE) = 0;
+
+	return uartRegister;
+}
+
+/**
+ * @brief Receive the bytes of a Buffer instead of Standard Input, for host replay programs
+ * @param uartId UART Id
+ * @param data Bytes to Receive, 0 --> back to Standard Input
+ * @param length Quantity Bytes, UART_RX_IDLE is returned after the last one
+ */
+void _hal_uartHostReplay(uchar uartId, const uchar *data, ulong length)
+{
+	if(uartId < 1 || uartId > 2)
+	{
+		return;
+	}
+
+	hostUartReplayData[uartId - 1] = data;
+	hostUartReplayLength[uartId - 1] = length;
+}
+
+/**
+ * @brief Get the Port Index of a Register Base
+ * @param uartRegister UART Register Base
+ * @return 0 --> SCI1, 1 --> SCI2
+ */
+uchar hostUartPort(vuchar *uartRegister)
+{
+	return uartRegister == hostUartRegister[1];
+}
+
+/**
+ * @brief Read Byte UART, waits for the byte like polling the receiver on the target
+ * @param uartRegister UART Register Base
+ * @return Byte Read, 0 at the end of the input
+ */
+uchar _hal_uartReadByte(vuchar *uartRegister)
+{
+	uchar port;
+	uchar readByte;
+
+	port = hostUartPort(uartRegister);
+
+	if(hostUartReplayData[port])
+	{
+		if(!hostUartReplayLength[port])
+		{
+			return 0;
+		}
+
+		hostUartReplayLength[port]--;
+		return *hostUartReplayData[port]++;
+	}
+
+	// Blocking read of Standard Input
+	if(read(STDIN_FILENO, &readByte, 1) != 1)
+	{
+		return 0;
+	}
+
+	return readByte;
+}
+
+/**
+ * @brief Read Received Byte without blocking
+ * @param uartRegister UART Register Base
+ * @param readByte Received Byte
+ * @return Receive Status, UART_RX_DATA if readByte is valid, 0 if no byte is waiting, UART_RX_IDLE at the end of the input
+ */
+uchar _hal_uartReceiveData(vuchar *uartRegister, uchar *readByte)
+{
+	struct pollfd input;
+	uchar port;
+
+	port = hostUartPort(uartRegister);
+
+	if(hostUartReplayData[port])
+	{
+		if(!hostUartReplayLength[port])
+		{
+			return UART_RX_IDLE;
+		}
+
+		hostUartReplayLength[port]--;
+		*readByte = *hostUartReplayData[port]++;
+		return UART_RX_DATA;
+	}
+
+	// Standard Input, nothing waiting like RXIFG clear
+	input.fd = STDIN_FILENO;
+	input.events = POLLIN;
+	input.revents = 0;
+
+	if(poll(&input, 1, 0) <= 0)
+	{
+		return 0;
+	}
+
+	// Readable with no byte is the end of the input
+	if(read(STDIN_FILENO, readByte, 1) != 1)
+	{
+		return UART_RX_IDLE;
+	}
+
+	return UART_RX_DATA;
+}
+
+/**
+ * @brief Write Byte UART
+ * @param uartRegister UART Register Base
+ * @param writeByte Byte to Write
+ */
+void _hal_uartWriteByte(vuchar *uartRegister, uchar writeByte)
+{
+	putchar(writeByte);
+}
+
+/**
+ * @brief Test if the Transmitter can accept the next byte
+ * @param uartRegister UART Register Base
+ * @return 1, Standard Output is always ready
+ */
+uchar _hal_uartTransmitReady(vuchar *uartRegister)
+{
+	return 1;
+}
+
+/**
+ * @brief Write Byte to Transmit Data Register without blocking
+ * @param uartRegister UART Register Base
+ * @param writeByte Byte to Write
+ */
+void _hal_uartTransmitData(vuchar *uartRegister, uchar writeByte)
+{
+	putchar(writeByte);
+}
+
+/**
+ * @brief Read Interrupt Enable/Disable, the application loop calls uartReceiveInterrupt while enabled
+ * @param uartRegister UART Register Base
+ * @param state Enable or Disable
+ */
+void _hal_uartReadInterrupt(vuchar *uartRegister, uchar state)
+{
+	*(uartRegister + OFFSET_SCIx_RIE) = state;
+}
+
+/**
+ * @brief Write Interrupt Enable/Disable, the application loop calls uartTransmitInterrupt while enabled
+ * @param uartRegister UART Register Base
+ * @param state Enable or Disable
+ */
+void _hal_uartWriteInterrupt(vuchar *uartRegister, uchar state)
+{
+	*(uartRegister + OFFSET_SCIx_TIE) = state;
+}
+
+#endif
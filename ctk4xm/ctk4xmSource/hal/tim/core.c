@@ -40,18 +40,18 @@ void _hal_coreSelectInternalClock(uchar frequencyMHz)
 			break;
 
 		case 8:
-			BCSCTL1 = CALBC1_1MHZ;
-			DCOCTL = CALDCO_1MHZ;
+			BCSCTL1 = CALBC1_8MHZ;
+			DCOCTL = CALDCO_8MHZ;
 			break;
 
 		case 12:
-			BCSCTL1 = CALBC1_1MHZ;
-			DCOCTL = CALDCO_1MHZ;
+			BCSCTL1 = CALBC1_12MHZ;
+			DCOCTL = CALDCO_12MHZ;
 			break;
 
 		case 16:
-			BCSCTL1 = CALBC1_1MHZ;
-			DCOCTL = CALDCO_1MHZ;
+			BCSCTL1 = CALBC1_16MHZ;
+			DCOCTL = CALDCO_16MHZ;
 			break;
 
 		default:
@@ -93,6 +93,32 @@ void _hal_coreDisableInterrupts()
 	_disable_interrupts();
 }
 
+/**
+ * @brief Disable Interrupts and return the previous state
+ * @return 1 --> Interrupts were enabled (GIE), 0 --> Disabled
+ */
+uchar _hal_coreSaveInterrupts()
+{
+	uchar state;
+
+	state = (__get_SR_register() & GIE) != 0;
+	_disable_interrupts();
+
+	return state;
+}
+
+/**
+ * @brief Restore the Interrupt State returned by _hal_coreSaveInterrupts
+ * @param state Interrupt State
+ */
+void _hal_coreRestoreInterrupts(uchar state)
+{
+	if(state)
+	{
+		_enable_interrupts();
+	}
+}
+
 /**
  * @brief Entry Low Power Mode
  */
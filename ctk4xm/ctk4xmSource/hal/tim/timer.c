@@ -27,10 +27,12 @@
 
 /**
  * @brief Set Count Timer
+ * @param valueCounter Period in us (Max 65535 / (DCO_FREQ / 1000000))
  */
 void _hal_timerSetCount(uint valueCounter)
 {
-	TACCR0 = valueCounter;
+	// Up Mode counts SMCLK from 0 to TACCR0
+	TACCR0 = valueCounter * (uint) (DCO_FREQ / 1000000UL) - 1;
 }
 
 /**
@@ -47,7 +49,7 @@ void _hal_timerInterruptEnable()
  */
 void _hal_timerClearInterruptFlag()
 {
-
+	TACTL &= ~(TAIFG);
 }
 
 /**
@@ -55,7 +57,8 @@ void _hal_timerClearInterruptFlag()
  */
 void _hal_timerStart()
 {
-
+	// Clock Source SMCLK, Up Mode
+	TACTL |= TASSEL_2 | MC_1;
 }
 
 /**
@@ -63,7 +66,25 @@ void _hal_timerStart()
  */
 void _hal_timerStop()
 {
+	TACTL &= ~(MC_3);
+}
+
+/**
+ * @brief Get Timer Counter
+ * @return Timer Counter, 0 to Period - 1
+ */
+uint _hal_timerGetCount()
+{
+	return TAR;
+}
 
+/**
+ * @brief Get Timer Period
+ * @return Timer Counts per Timer Interrupt
+ */
+uint _hal_timerGetPeriod()
+{
+	return TACCR0 + 1;
 }
 
 #endif
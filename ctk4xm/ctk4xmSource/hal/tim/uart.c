@@ -21,52 +21,508 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "uart.h"
+#include "hal/uart.h"
 
 #ifdef TIM
 
+// UART Module Pins Definition
+// USCI_A0 --> P1.1 (RX), P1.2 (TX)
+// Timer1_A --> P2.1 TA1.1 (RX), P2.0 TA1.0 (TX)
+#define SCI1_PINS		BIT1 + BIT2
+#define SCI2_TX_PIN		BIT0
+#define SCI2_RX_PIN		BIT1
+
+/**
+ * UART Clock, SMCLK sourced from DCO
+ */
+#define	UART_CLK		DCO_FREQ
+
+#define	ABS_DIFF(a, b)	((a) > (b) ? (a) - (b) : (b) - (a))
+
+#if (UART_CLK / SCI1_BPS) >= 16
+
+	// Oversampling Mode --> N = 16 * UCBRx + UCBRFx
+	#define	SC1_N		((UART_CLK + SCI1_BPS / 2) / SCI1_BPS)
+	#define	SC1_BR		(SC1_N / 16)
+	#define	SC1_MCTL	(((SC1_N % 16) << 4) | UCOS16)
+
+	#if ABS_DIFF(SC1_N * SCI1_BPS, UART_CLK) * 50 > UART_CLK
+	#error "SCI1_BPS baud rate error above 2% with DCO_FREQ"
+	#endif
+
+#else
+
+	// Low-Frequency Mode --> N = UCBRx + UCBRSx / 8
+	#define	SC1_N8		((UART_CLK * 8 + SCI1_BPS / 2) / SCI1_BPS)
+	#define	SC1_BR		(SC1_N8 / 8)
+	#define	SC1_MCTL	((SC1_N8 % 8) << 1)
+
+	#if ABS_DIFF(SC1_N8 * SCI1_BPS, UART_CLK * 8) * 50 > UART_CLK * 8
+	#error "SCI1_BPS baud rate error above 2% with DCO_FREQ"
+	#endif
+
+#endif
+
+#define	SC1_BR0			(SC1_BR & 0x00FF)
+#define	SC1_BR1			((SC1_BR & 0xFF00) >> 8)
+
+// Software UART Bit Time in Timer Clocks
+#define	SC2_BIT			((UART_CLK + SCI2_BPS / 2) / SCI2_BPS)
+#define	SC2_HALF_BIT	(SC2_BIT / 2)
+
+#if ABS_DIFF(SC2_BIT * SCI2_BPS, UART_CLK) * 50 > UART_CLK
+#error "SCI2_BPS baud rate error above 2% with DCO_FREQ"
+#endif
+
+// Software UART ISR Path in CPU Cycles per Bit (interrupt entry, isrTimer1Chx, uartReceiveInterrupt or
+// uartTransmitInterrupt and the bit handler, about 150 each), RX and TX bits can fall in the same bit time
+#define	SC2_MIN_BIT		400
+
+#if SC2_BIT < SC2_MIN_BIT
+#error "SCI2_BPS too fast for DCO_FREQ, the Software UART needs SC2_MIN_BIT cycles per bit"
+#endif
+
+/**
+ * Software UART Register Base (Timer1_A)
+ */
+#define	SCI2_REGISTER	((vuchar *) &TA1CTL)
+
+//				USCI_A0
+//				-------
+//	UCAxCTL0	0x0060
+//	UCAxCTL1	0x0061
+//	UCAxBR0		0x0062
+//	UCAxBR1		0x0063
+//	UCAxMCTL	0x0064
+//	UCAxSTAT	0x0065
+//	UCAxRXBUF	0x0066
+//	UCAxTXBUF	0x0067
+
+/**
+ * UCAxCTL0 to UCAxCTL1 Register Offset
+ */
+const uchar OFFSET_UCAxCTL0_UCAxCTL1 = 1;
+
+/**
+ * UCAxCTL0 to UCAxBR0 Register Offset
+ */
+const uchar OFFSET_UCAxCTL0_UCAxBR0 = 2;
+
+/**
+ * UCAxCTL0 to UCAxBR1 Register Offset
+ */
+const uchar OFFSET_UCAxCTL0_UCAxBR1 = 3;
+
+/**
+ * UCAxCTL0 to UCAxMCTL Register Offset
+ */
+const uchar OFFSET_UCAxCTL0_UCAxMCTL = 4;
+
+/**
+ * UCAxCTL0 to UCAxSTAT Register Offset
+ */
+const uchar OFFSET_UCAxCTL0_UCAxSTAT = 5;
+
+/**
+ * UCAxCTL0 to UCAxRXBUF Register Offset
+ */
+const uchar OFFSET_UCAxCTL0_UCAxRXBUF = 6;
+
+/**
+ * UCAxCTL0 to UCAxTXBUF Register Offset
+ */
+const uchar OFFSET_UCAxCTL0_UCAxTXBUF = 7;
+
+/**
+ * Software UART Transmit Shift Register, Start + 8 Data + Stop Bits
+ */
+volatile uint softUartTxData;
+
+/**
+ * Software UART Transmit Bits Pending
+ */
+volatile uchar softUartTxBitCount;
+
+/**
+ * Software UART Receive Shift Register
+ */
+volatile uchar softUartRxData;
+
+/**
+ * Software UART Receive Bits Pending
+ */
+volatile uchar softUartRxBitCount;
+
+/**
+ * @brief Software UART Receive Bit, called on Timer1_A CCR1 Capture/Compare
+ * @param readByte Received Byte
+ * @return Receive Status, UART_RX_DATA if a byte was received
+ */
+uchar _hal_softUartReceiveBit(uchar *readByte)
+{
+	// Clear CCR1 Interrupt Flag
+	TA1CCTL1 &= ~(CCIFG);
+
+	// Start Bit Edge Captured, sample next bits in the middle
+	if(TA1CCTL1 & CAP)
+	{
+		TA1CCTL1 &= ~(CAP);
+		TA1CCR1 += SC2_BIT + SC2_HALF_BIT;
+		softUartRxBitCount = 9;
+		return 0;
+	}
+
+	TA1CCR1 += SC2_BIT;
+	softUartRxBitCount--;
+
+	// Sample Data Bit, LSB first
+	if(softUartRxBitCount)
+	{
+		softUartRxData >>= 1;
+
+		if(TA1CCTL1 & SCCI)
+		{
+			softUartRxData |= 0x80;
+		}
+
+		return 0;
+	}
+
+	// Stop Bit, wait for next Start Bit Edge
+	TA1CCTL1 |= CAP;
+
+	// Discard byte without Stop Bit
+	if(!(TA1CCTL1 & SCCI))
+	{
+		return UART_RX_FRAMING;
+	}
+
+	*readByte = softUartRxData;
+
+	return UART_RX_DATA;
+}
+
+/**
+ * @brief Software UART Output Next Bit on next CCR0 Compare
+ * Set Output Mode --> Mark, Reset Output Mode --> Space
+ */
+void _hal_softUartOutputBit()
+{
+	if(softUartTxData & 0x01)
+	{
+		TA1CCTL0 &= ~(OUTMOD2);
+	}
+	else
+	{
+		TA1CCTL0 |= OUTMOD2;
+	}
+
+	softUartTxData >>= 1;
+	softUartTxBitCount--;
+}
+
+/**
+ * @brief Software UART Transmit Bit, called on Timer1_A CCR0 Compare
+ * @return 1 if the next byte can be written, 0 otherwise
+ */
+uchar _hal_softUartTransmitBit()
+{
+	TA1CCR0 += SC2_BIT;
+
+	// Stop Bit on the line, ready for next byte
+	if(!softUartTxBitCount)
+	{
+		return 1;
+	}
+
+	_hal_softUartOutputBit();
+
+	return 0;
+}
+
+/**
+ * @brief Software UART Load Byte, Start Bit is output on next CCR0 Compare
+ * @param writeByte Byte to Write
+ */
+void _hal_softUartTransmitByte(uchar writeByte)
+{
+	softUartTxData = ((uint) writeByte | 0x100) << 1;
+	softUartTxBitCount = 10;
+
+	_hal_softUartOutputBit();
+}
+
+/**
+ * @brief Software UART Start Bit Timing, Line stays at Mark
+ * @param interruptEnable CCIE or 0
+ */
+void _hal_softUartTransmitStart(uint interruptEnable)
+{
+	softUartTxBitCount = 0;
+	TA1CCR0 = TA1R + SC2_BIT;
+	TA1CCTL0 = OUTMOD_1 | interruptEnable;
+}
+
 /**
  * @brief Init UART Module
  * @param uartId UART Id
+ * @return UART Register Base, 0 if uartId is not valid
+ * UART1 --> USCI_A0 P1.1 (RX), P1.2 (TX)
+ * UART2 --> Timer1_A Software UART P2.1 (RX), P2.0 (TX), DCO_FREQ / SCI2_BPS >= SC2_MIN_BIT (8MHz for 9600 bps)
  */
-void _hal_uartInit(uchar uartId)
+vuchar * _hal_uartInit(uchar uartId)
 {
+	vuchar *uartRegister;
+
+	switch(uartId)
+	{
+		case 1:
+			uartRegister = &UCA0CTL0;
+
+			// Hold USCI in Reset, Clock Source SMCLK, Erroneous Characters set UCA0RXIFG
+			*(uartRegister + OFFSET_UCAxCTL0_UCAxCTL1) = UCSSEL_2 | UCRXEIE | UCSWRST;
+
+			// UART Mode, 8 Data Bits, No Parity, 1 Stop Bit
+			*uartRegister = 0;
+
+			// Baud Rate Divisor and Modulation
+			*(uartRegister + OFFSET_UCAxCTL0_UCAxBR0) = SC1_BR0;
+			*(uartRegister + OFFSET_UCAxCTL0_UCAxBR1) = SC1_BR1;
+			*(uartRegister + OFFSET_UCAxCTL0_UCAxMCTL) = SC1_MCTL;
+
+			// Configure UCA0RXD and UCA0TXD Pins
+			P1SEL |= SCI1_PINS;
+			P1SEL2 |= SCI1_PINS;
 
+			// Release USCI Reset
+			*(uartRegister + OFFSET_UCAxCTL0_UCAxCTL1) &= ~(UCSWRST);
+			break;
+		case 2:
+			uartRegister = SCI2_REGISTER;
+
+			// Timer1_A Continuous Mode, Clock Source SMCLK
+			TA1CTL = TASSEL_2 | MC_2 | TACLR;
+
+			// TX Idle at Mark
+			TA1CCTL0 = OUT;
+			softUartTxBitCount = 0;
+
+			// RX Capture Falling Edge (Start Bit) on CCI1A, Synchronous
+			TA1CCTL1 = CM_2 | CCIS_0 | SCS | CAP;
+
+			// Configure TA1.0 and TA1.1 Pins
+			P2DIR |= SCI2_TX_PIN;
+			P2DIR &= ~(SCI2_RX_PIN);
+			P2SEL |= SCI2_TX_PIN | SCI2_RX_PIN;
+			P2SEL2 &= ~(SCI2_TX_PIN | SCI2_RX_PIN);
+			break;
+		default:
+			return 0;
+	}
+
+	return uartRegister;
 }
 
 /**
  * @brief Read Byte UART
+ * @param uartRegister UART Register Base
  */
-uchar _hal_uartReadByte()
+uchar _hal_uartReadByte(vuchar *uartRegister)
 {
-	uchar readByte = 0;
+	uchar readByte;
+
+	if(uartRegister == SCI2_REGISTER)
+	{
+		// Poll Capture/Compare Events until a byte is complete
+		do
+		{
+			while(!(TA1CCTL1 & CCIFG));
+		}
+		while(!(_hal_softUartReceiveBit(&readByte) & UART_RX_DATA));
+
+		return readByte;
+	}
+
+	// Wait for Reception Complete
+	while(!(IFG2 & UCA0RXIFG));
+
+	return *(uartRegister + OFFSET_UCAxCTL0_UCAxRXBUF);
+}
+
+/**
+ * @brief Read Received Byte and Error Flags without blocking, clears the flags
+ * @param uartRegister UART Register Base
+ * @param readByte Received Byte
+ * @return Receive Status, UART_RX_DATA if readByte is valid
+ * USCI_A0 has no Noise Flag and no Idle Line detection in UART Mode
+ */
+uchar _hal_uartReceiveData(vuchar *uartRegister, uchar *readByte)
+{
+	uchar statusRegister;
+	uchar status;
+
+	if(uartRegister == SCI2_REGISTER)
+	{
+		return _hal_softUartReceiveBit(readByte);
+	}
+
+	if(!(IFG2 & UCA0RXIFG))
+	{
+		return 0;
+	}
+
+	// Read Status before Receive Buffer, reading UCA0RXBUF clears UCA0RXIFG and Error Flags
+	statusRegister = *(uartRegister + OFFSET_UCAxCTL0_UCAxSTAT);
+	*readByte = *(uartRegister + OFFSET_UCAxCTL0_UCAxRXBUF);
+	status = 0;
 
-	return readByte;
+	// Received Byte is still valid with Overrun, previous byte is lost
+	if(statusRegister & UCOE)
+	{
+		status |= UART_RX_OVERRUN;
+	}
+	if(statusRegister & (UCFE | UCBRK))
+	{
+		status |= UART_RX_FRAMING;
+	}
+	if(statusRegister & UCPE)
+	{
+		status |= UART_RX_PARITY;
+	}
+	if(!(statusRegister & (UCFE | UCBRK | UCPE)))
+	{
+		status |= UART_RX_DATA;
+	}
+
+	return status;
 }
 
 /**
  * @brief Write Byte UART
+ * @param uartRegister UART Register Base
+ * @param writeByte Byte to Write
+ */
+void _hal_uartWriteByte(vuchar *uartRegister, uchar writeByte)
+{
+	if(uartRegister == SCI2_REGISTER)
+	{
+		// Poll Compare Events until the Stop Bit is on the line
+		_hal_softUartTransmitStart(0);
+		_hal_softUartTransmitByte(writeByte);
+
+		do
+		{
+			while(!(TA1CCTL0 & CCIFG));
+			TA1CCTL0 &= ~(CCIFG);
+		}
+		while(!_hal_softUartTransmitBit());
+
+		return;
+	}
+
+	// Wait for Transmit Buffer Empty
+	while(!(IFG2 & UCA0TXIFG));
+
+	// Write Byte to Send
+	*(uartRegister + OFFSET_UCAxCTL0_UCAxTXBUF) = writeByte;
+}
+
+/**
+ * @brief Test if the Transmitter can accept the next byte, called from TX ISR
+ * @param uartRegister UART Register Base
+ * @return 1 if the next byte can be written, 0 otherwise
+ */
+uchar _hal_uartTransmitReady(vuchar *uartRegister)
+{
+	if(uartRegister == SCI2_REGISTER)
+	{
+		return _hal_softUartTransmitBit();
+	}
+
+	// TX ISR is only requested with Transmit Buffer Empty
+	return 1;
+}
+
+/**
+ * @brief Write Byte to Transmit Data Register without blocking
+ * @param uartRegister UART Register Base
  * @param writeByte Byte to Write
  */
-void _hal_uartWriteByte(uchar writeByte)
+void _hal_uartTransmitData(vuchar *uartRegister, uchar writeByte)
 {
+	if(uartRegister == SCI2_REGISTER)
+	{
+		_hal_softUartTransmitByte(writeByte);
+		return;
+	}
 
+	// Write Transmit Buffer to clear UCA0TXIFG Flag
+	*(uartRegister + OFFSET_UCAxCTL0_UCAxTXBUF) = writeByte;
 }
 
 /**
  * @brief Read Interrupt Enable/Disable
+ * @param uartRegister UART Register Base
+ * @param state Enabled or Disabled
  */
-void _hal_uartReadInterrupt(uchar state)
+void _hal_uartReadInterrupt(vuchar *uartRegister, uchar state)
 {
+	if(uartRegister == SCI2_REGISTER)
+	{
+		if(state)
+		{
+			TA1CCTL1 &= ~(CCIFG);
+			TA1CCTL1 |= CCIE;
+		}
+		else
+		{
+			TA1CCTL1 &= ~(CCIE);
+		}
+		return;
+	}
 
+	if(state)
+	{
+		IE2 |= UCA0RXIE;
+	}
+	else
+	{
+		IE2 &= ~(UCA0RXIE);
+	}
 }
 
 /**
- * @brief Write Interrupt Enable/Disable
+ * @brief Write Interrupt (Transmit Data Register Empty) Enable/Disable
+ * @param uartRegister UART Register Base
+ * @param state Enabled or Disabled
  */
-void _hal_uartWriteInterrupt(uchar state)
+void _hal_uartWriteInterrupt(vuchar *uartRegister, uchar state)
 {
+	if(uartRegister == SCI2_REGISTER)
+	{
+		if(state)
+		{
+			// Start Bit Timing only if the transmitter is idle
+			if(!(TA1CCTL0 & CCIE))
+			{
+				_hal_softUartTransmitStart(CCIE);
+			}
+		}
+		else
+		{
+			TA1CCTL0 &= ~(CCIE);
+		}
+		return;
+	}
 
+	if(state)
+	{
+		IE2 |= UCA0TXIE;
+	}
+	else
+	{
+		IE2 &= ~(UCA0TXIE);
+	}
 }
 
 #endif
@@ -555,6 +555,39 @@ void lcdDataFloatFormat(float dataExport, uchar quantityDigits, uchar quantityDe
 	}
 }
 
+/**
+ * @brief Send Data Fixed-Point Format LCD Module
+ * @param dataExport Data to Send to LCD Module, scaled by 10^quantityDecimals
+ * @param quantityDigits Quantity Digits
+ * @param quantityDecimals Quantity Decimals
+ */
+void lcdDataFixedFormat(ulong dataExport, uchar quantityDigits, uchar quantityDecimals)
+{
+	uchar i = 0;
+	ulong divisor = 1;
+	uchar digitExport = 0;
+
+	// Obtain Maximum Divisor
+	for(i = 1; i < (quantityDigits + quantityDecimals); i++)
+	{
+		divisor *= 10;
+	}
+
+	// Print Digits, higher digits than quantityDigits are dropped
+	for(i = 0; i < (quantityDigits + quantityDecimals); i++)
+	{
+		// Print Decimal Separator
+		if(i == quantityDigits)
+		{
+			lcdData(',');
+		}
+
+		digitExport = (uchar) ((dataExport / divisor) % 10);
+		lcdData(digitExport + 0x30);
+		divisor /= 10;
+	}
+}
+
 /**
  * @brief Send Data Date Format LCD Module
  * @param row LCD Row
@@ -0,0 +1,261 @@
+/**
+ *  @file navigation.c
+ *  @brief Module that Navigates a Waypoint List, Bearing and Distance to the Active Waypoint
+ *  @date 17/10/2026
+ *  @version 1.0.0
+ *
+ *  C Toolkit For X Microcontroller
+ *  Copyright (C) 2013 Leandro Perez Guatibonza
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "navigation.h"
+
+/**
+ * Arc Tangent 0.01 Degrees from 0 to 1, 1/32 step
+ */
+const uint navigationAtanTable[33] =
+{
+	0, 179, 358, 536, 713, 888, 1062, 1234, 1404, 1571, 1735,
+	1897, 2056, 2211, 2363, 2511, 2657, 2798, 2936, 3070, 3201,
+	3327, 3451, 3571, 3687, 3800, 3909, 4016, 4119, 4218, 4315,
+	4409, 4500
+};
+
+/**
+ * Waypoint Table
+ */
+const navigationStructWaypoint *navigationWaypoints;
+
+/**
+ * Waypoint Quantity
+ */
+uchar navigationQtyWaypoints;
+
+/**
+ * Arrival Radius in Centimeters
+ */
+ulong navigationArrivalRadius;
+
+/**
+ * Waypoint Reached Callback
+ */
+void (*navigationCallback)(uchar waypoint);
+
+/**
+ * Navigation Result of the last fix
+ */
+navigationStructResult navigationResult;
+
+/**
+ * @brief Navigation Init, the first waypoint is active
+ * @param waypoints Waypoint Table
+ * @param qtyWaypoints Quantity Waypoints
+ * @param arrivalRadius Distance in Centimeters to consider a waypoint reached (Ex. 2500 --> 25 m)
+ * @param callback Function called with the waypoint index when it is reached
+ */
+void navigationInit(const navigationStructWaypoint *waypoints, uchar qtyWaypoints, ulong arrivalRadius, void (*callback)(uchar waypoint))
+{
+	navigationWaypoints = waypoints;
+	navigationQtyWaypoints = qtyWaypoints;
+	navigationArrivalRadius = arrivalRadius;
+	navigationCallback = callback;
+
+	navigationResult.state = NAVIGATION_IDLE;
+	navigationResult.waypoint = 0;
+	navigationResult.distance = 0;
+	navigationResult.bearing = 0;
+	navigationResult.turn = 0;
+
+	// Sequence 0 is never published
+	navigationResult.sequence = 0;
+}
+
+/**
+ * @brief Select the Active Waypoint (Ex. stop skipped by the driver), the result is updated on the next fix
+ * @param waypoint Waypoint Index, qtyWaypoints or more finishes the route
+ */
+void navigationSetWaypoint(uchar waypoint)
+{
+	navigationResult.waypoint = waypoint < navigationQtyWaypoints ? waypoint : navigationQtyWaypoints;
+
+	// Next fix is used even if it was already
+	navigationResult.sequence = 0;
+}
+
+/**
+ * @brief Bearing of an Offset, table-driven atan2
+ * @param north North Offset
+ * @param east East Offset
+ * @return Bearing 0 to 35999 in 0.01 Degrees clockwise from North, error below 0.02 Degrees
+ */
+uint navigationBearing(slong north, slong east)
+{
+	ulong y;
+	ulong x;
+	ulong ratio;
+	uchar index;
+	uint angle;
+
+	y = distanceAbs(north);
+	x = distanceAbs(east);
+
+	if(x == 0 && y == 0)
+	{
+		return 0;
+	}
+
+	// Scale so that the smaller component shifted by 16 fits in 32 bits
+	while(x > 0xFFFF || y > 0xFFFF)
+	{
+		x >>= 1;
+		y >>= 1;
+	}
+
+	// Angle from the nearest axis 0 to 45 Degrees, ratio Q16 up to 1.0
+	if(x <= y)
+	{
+		ratio = (x << 16) / y;
+	}
+	else
+	{
+		ratio = (y << 16) / x;
+	}
+
+	// Linear Interpolation, 11 bits between table entries
+	index = (uchar) (ratio >> 11);
+
+	if(index >= 32)
+	{
+		angle = navigationAtanTable[32];
+	}
+	else
+	{
+		angle = navigationAtanTable[index] + (uint) (((navigationAtanTable[index + 1] - navigationAtanTable[index]) * (ratio & 0x7FF) + 0x400) >> 11);
+	}
+
+	// Angle from North in the first quadrant
+	if(x > y)
+	{
+		angle = 9000 - angle;
+	}
+
+	// Quadrant
+	if(north >= 0)
+	{
+		return east >= 0 ? angle : (angle ? 36000 - angle : 0);
+	}
+
+	return east >= 0 ? 18000 - angle : 18000 + angle;
+}
+
+/**
+ * @brief Distance and Bearing from the Fix to the Active Waypoint
+ * @param fix GPS Fix
+ */
+void navigationMeasure(const gpsStructNmeaGPRMC *fix)
+{
+	const navigationStructWaypoint *waypoint;
+	slong north;
+	slong east;
+	slong turn;
+
+	waypoint = &navigationWaypoints[navigationResult.waypoint];
+
+	// Cosine of latitude scaling at the fix position
+	distanceOffset((*fix).latitude, (*fix).longitude, (*waypoint).latitude, (*waypoint).longitude, &north, &east);
+
+	navigationResult.distance = distanceHypot(distanceAbs(north), distanceAbs(east));
+	navigationResult.bearing = navigationBearing(north, east);
+
+	// Course is not valid when stopped
+	if((*fix).speedOverGround < GPS_ODOMETER_MIN_SPEED)
+	{
+		navigationResult.turn = 0;
+		return;
+	}
+
+	turn = (slong) navigationResult.bearing - (slong) (*fix).course;
+
+	if(turn >= 18000)
+	{
+		turn -= 36000;
+	}
+	else if(turn < -18000)
+	{
+		turn += 36000;
+	}
+
+	navigationResult.turn = (signed int) turn;
+}
+
+/**
+ * @brief Navigate with the GPS Fix, call from the main loop
+ * A fix already used (same sequence) is ignored, reached waypoints advance to the next one
+ * Usually one measure per fix, waypoints closer than the arrival radius are passed in the same call,
+ * at most the waypoints left (qtyWaypoints - waypoint) measures
+ * @param fix GPS Fix from gpsGetFix
+ * @return Quantity Waypoints reached
+ */
+uchar navigationUpdate(const gpsStructNmeaGPRMC *fix)
+{
+	uchar qtyReached;
+
+	// No fix yet or fix already used
+	if((*fix).sequence == navigationResult.sequence)
+	{
+		return 0;
+	}
+
+	navigationResult.sequence = (*fix).sequence;
+	qtyReached = 0;
+
+	// Each pass measures one waypoint and advances only on arrival, bounded by the waypoints left
+	while(navigationResult.waypoint < navigationQtyWaypoints)
+	{
+		navigationResult.state = NAVIGATION_ACTIVE;
+		navigationMeasure(fix);
+
+		if(navigationResult.distance > navigationArrivalRadius)
+		{
+			return qtyReached;
+		}
+
+		// Arrival, advance and measure to the next waypoint
+		qtyReached++;
+
+		if(navigationCallback)
+		{
+			navigationCallback(navigationResult.waypoint);
+		}
+
+		navigationResult.waypoint++;
+	}
+
+	navigationResult.state = NAVIGATION_FINISHED;
+	navigationResult.distance = 0;
+	navigationResult.turn = 0;
+
+	return qtyReached;
+}
+
+/**
+ * @brief Get Navigation Result
+ * @param result Copy of the Navigation Result
+ */
+void navigationGetResult(navigationStructResult *result)
+{
+	*result = navigationResult;
+}
@@ -24,6 +24,11 @@
 #include "timer.h"
 #include "hal/timer.h"
 
+/**
+ * System Tick, Timer Interrupts counted since reset
+ */
+volatile ulong timerTick;
+
 /**
  * @brief Set Count Timer
  */
@@ -63,3 +68,58 @@ void timerStop()
 {
 	_hal_timerStop();
 }
+
+/**
+ * @brief Increment System Tick, called from Timer Interrupt
+ */
+void timerTickIncrement()
+{
+	timerTick++;
+}
+
+/**
+ * @brief Get System Tick
+ * @return Timer Interrupts counted since reset
+ */
+ulong timerGetTick()
+{
+	ulong tick;
+
+	// Read again if the Timer Interrupt updated the tick in between
+	do
+	{
+		tick = timerTick;
+	}
+	while(tick != timerTick);
+
+	return tick;
+}
+
+/**
+ * @brief Get Timer Counter, measure short intervals inside a Tick
+ * @return Timer Counter
+ */
+uint timerGetCount()
+{
+	return _hal_timerGetCount();
+}
+
+/**
+ * @brief Timer Counts elapsed since startCount, intervals shorter than one Tick
+ * @param startCount Timer Counter at the start of the interval
+ * @return Elapsed Timer Counts
+ */
+uint timerElapsed(uint startCount)
+{
+	uint count;
+
+	count = _hal_timerGetCount();
+
+	// Counter restarted from 0 at the end of the period
+	if(count < startCount)
+	{
+		count += _hal_timerGetPeriod();
+	}
+
+	return count - startCount;
+}
@@ -22,46 +22,556 @@
  */
 
 #include "uart.h"
+#include "core.h"
 #include "hal/uart.h"
 
+#if defined(UART_TIMESTAMP) || defined(UART_ISR_PROFILE)
+#include "timer.h"
+#endif
+
+/**
+ * UART Receive Ring Buffer Mask
+ */
+#define	UART_RX_BUFFER_MASK		(UART_RX_BUFFER_SIZE - 1)
+
+/**
+ * UART Transmit Queue Mask
+ */
+#define	UART_TX_BUFFER_MASK		(UART_TX_BUFFER_SIZE - 1)
+
+/**
+ * UART Line Pool Mask
+ */
+#define	UART_LINE_MASK			(UART_LINE_QTY - 1)
+
+/**
+ * UART Receive Errors that corrupt the current line
+ */
+#define	UART_RX_LINE_ERROR		(UART_RX_OVERRUN | UART_RX_FRAMING | UART_RX_PARITY)
+
+/**
+ * UART Handles
+ */
+uartStructHandle uartHandle[UART_QTY_PORTS];
+
+/**
+ * @brief Reset UART Statistics
+ * @param uart UART Handle
+ */
+void uartResetStats(uartStructHandle *uart)
+{
+	vuchar *stats;
+	uchar i;
+
+	stats = (vuchar *) &uart->stats;
+
+	for(i = 0; i < sizeof(uartStructStats); i++)
+	{
+		stats[i] = 0;
+	}
+}
+
+/**
+ * @brief Open UART Port, configure pins, baud rate and buffers
+ * @param uartId UART Id
+ * @return UART Handle, 0 if uartId is not valid
+ * SCI1 --> SCI1_BPS
+ * SCI2 --> SCI2_BPS
+ */
+uartStructHandle * uartOpen(uchar uartId)
+{
+	uartStructHandle *uart;
+
+	if(uartId < SCI1 || uartId > UART_QTY_PORTS)
+	{
+		return 0;
+	}
+
+	uart = &uartHandle[uartId - 1];
+	uart->uartId = uartId;
+
+	// Initialize Receive Ring Buffer
+	uart->rxBuffer.head = 0;
+	uart->rxBuffer.tail = 0;
+
+	// Initialize Transmit Queue
+	uart->txQueue.head = 0;
+	uart->txQueue.tail = 0;
+	uart->txQueue.writeCompleteCallback = 0;
+
+	// Ring Buffer Mode
+	uart->linePool = 0;
+
+	// Initialize Statistics
+	uartResetStats(uart);
+
+	// Configure Port
+	uart->registerBase = _hal_uartInit(uartId);
+
+	return uart;
+}
+
+/**
+ * @brief Read Byte UART, polling the receiver
+ * @param uart UART Handle
+ */
+uchar uartReadByte(uartStructHandle *uart)
+{
+	return _hal_uartReadByte(uart->registerBase);
+}
+
+/**
+ * @brief Read Bytes from UART Receive Buffer without blocking
+ * @param uart UART Handle
+ * @param buffer Destination Buffer
+ * @param maxLength Maximum Bytes to Read
+ * @return Quantity Bytes Read
+ */
+uchar uartRead(uartStructHandle *uart, uchar *buffer, uchar maxLength)
+{
+	uartStructRingBuffer *ringBuffer;
+	uchar tail;
+	uchar qtyRead;
+
+	ringBuffer = &uart->rxBuffer;
+	tail = ringBuffer->tail;
+	qtyRead = 0;
+
+	// Copy bytes until the buffer is empty or the destination is full
+	while(qtyRead < maxLength && tail != ringBuffer->head)
+	{
+		buffer[qtyRead] = ringBuffer->buffer[tail];
+		tail = (tail + 1) & UART_RX_BUFFER_MASK;
+		qtyRead++;
+	}
+
+	// Release read positions to the ISR
+	ringBuffer->tail = tail;
+
+	return qtyRead;
+}
+
+/**
+ * @brief Quantity Bytes Available in UART Receive Buffer
+ * @param uart UART Handle
+ * @return Quantity Bytes Available
+ */
+uchar uartAvailable(uartStructHandle *uart)
+{
+	return (uart->rxBuffer.head - uart->rxBuffer.tail) & UART_RX_BUFFER_MASK;
+}
+
+/**
+ * @brief Select Line Mode, RX ISR stores complete lines in the Line Pool
+ * @param uart UART Handle
+ * @param linePool Line Pool, 0 to return to Ring Buffer Mode
+ * @param delimiter Line Delimiter, 1 or 2 characters (Ex. "\r\n"), not stored in the line
+ */
+void uartLineMode(uartStructHandle *uart, uartStructLinePool *linePool, const uchar *delimiter)
+{
+	if(linePool)
+	{
+		linePool->head = 0;
+		linePool->tail = 0;
+		linePool->position = 0;
+		linePool->lineError = 0;
+
+		// Two Characters Delimiter, first one is only stripped
+		if(delimiter[1])
+		{
+			linePool->delimiterFirst = delimiter[0];
+			linePool->delimiterLast = delimiter[1];
+		}
+		else
+		{
+			linePool->delimiterFirst = 0;
+			linePool->delimiterLast = delimiter[0];
+		}
+	}
+
+	uart->linePool = linePool;
+}
+
+/**
+ * @brief Get Oldest Completed Line without copy
+ * @param uart UART Handle
+ * @param length Quantity Characters in the Line
+ * @return Line Pointer (null terminated), 0 if there is no completed line
+ */
+uchar * uartReadLine(uartStructHandle *uart, uchar *length)
+{
+	uartStructLinePool *linePool;
+	uchar tail;
+
+	linePool = uart->linePool;
+	tail = linePool->tail;
+
+	if(tail == linePool->head)
+	{
+		return 0;
+	}
+
+	*length = linePool->length[tail];
+
+	return linePool->line[tail];
+}
+
+/**
+ * @brief Release Line returned by uartReadLine to the RX ISR
+ * @param uart UART Handle
+ */
+void uartReleaseLine(uartStructHandle *uart)
+{
+	uart->linePool->tail = (uart->linePool->tail + 1) & UART_LINE_MASK;
+}
+
+/**
+ * @brief Store Received Byte in the Line Pool, called from RX ISR
+ * @param uart UART Handle
+ * @param readByte Received Byte
+ */
+void uartReceiveLineByte(uartStructHandle *uart, uchar readByte)
+{
+	uartStructLinePool *linePool;
+	uchar head;
+	uchar position;
+	uchar lineError;
+
+	linePool = uart->linePool;
+	head = linePool->head;
+	position = linePool->position;
+
+	if(readByte != linePool->delimiterLast)
+	{
+		// Store Character, position UART_LINE_SIZE marks a line too long
+		if(position < UART_LINE_SIZE - 1)
+		{
+			linePool->line[head][position] = readByte;
+			linePool->position = position + 1;
+		}
+		else
+		{
+			linePool->position = UART_LINE_SIZE;
+		}
+		return;
+	}
+
+	// Delimiter Found, start next line in the same buffer by default
+	linePool->position = 0;
+	lineError = linePool->lineError;
+	linePool->lineError = 0;
+
+	if(position == UART_LINE_SIZE)
+	{
+		uart->stats.rxLineTooLong++;
+		return;
+	}
+
+	// Discard line with lost or corrupted characters
+	if(lineError)
+	{
+		uart->stats.rxLineError++;
+		return;
+	}
+
+	// Strip First Delimiter Character
+	if(position && linePool->line[head][position - 1] == linePool->delimiterFirst && linePool->delimiterFirst)
+	{
+		position--;
+	}
+
+	// Skip Empty Lines
+	if(!position)
+	{
+		return;
+	}
+
+	// Discard line if consumer still holds all the other lines
+	if(((head + 1) & UART_LINE_MASK) == linePool->tail)
+	{
+		uart->stats.rxLineOverrun++;
+		return;
+	}
+
+	// Hand Line to the consumer
+	linePool->line[head][position] = 0;
+	linePool->length[head] = position;
+	linePool->head = (head + 1) & UART_LINE_MASK;
+}
+
+/**
+ * @brief Get UART Statistics
+ * @param uart UART Handle
+ * @param stats Copy of the UART Statistics
+ */
+void uartGetStats(uartStructHandle *uart, uartStructStats *stats)
+{
+	uchar interruptState;
+
+	// Counters are updated by the ISRs, may be called from an ISR
+	interruptState = coreSaveInterrupts();
+	*stats = uart->stats;
+	coreRestoreInterrupts(interruptState);
+}
+
 /**
- * @brief Init UART Module
- * @param frequencyMHz MCU Frequency in MHz
+ * @brief Clear UART Statistics
+ * @param uart UART Handle
  */
-void uartInit(uchar uartId)
+void uartClearStats(uartStructHandle *uart)
 {
-	_hal_uartInit(uartId);
+	uchar interruptState;
+
+	interruptState = coreSaveInterrupts();
+	uartResetStats(uart);
+	coreRestoreInterrupts(interruptState);
 }
 
 /**
- * @brief Read Byte UART
+ * @brief Count Receive Errors and Idle Line, called from RX ISR
+ * @param uart UART Handle
+ * @param status Receive Status
  */
-uchar uartReadByte()
+void uartReceiveStatus(uartStructHandle *uart, uchar status)
 {
-	return _hal_uartReadByte();
+	if(status & UART_RX_OVERRUN)
+	{
+		uart->stats.rxErrorOverrun++;
+	}
+	if(status & UART_RX_FRAMING)
+	{
+		uart->stats.rxErrorFraming++;
+	}
+	if(status & UART_RX_NOISE)
+	{
+		uart->stats.rxErrorNoise++;
+	}
+	if(status & UART_RX_PARITY)
+	{
+		uart->stats.rxErrorParity++;
+	}
+
+	// Line Mode, discard the current line at the next delimiter
+	if((status & UART_RX_LINE_ERROR) && uart->linePool)
+	{
+		uart->linePool->lineError = 1;
+	}
+
+	if(status & UART_RX_IDLE)
+	{
+		uart->stats.rxIdle++;
+	}
+
+#ifdef UART_TIMESTAMP
+	if(status & UART_RX_ERROR)
+	{
+		uart->stats.rxErrorTick = timerGetTick();
+	}
+	if(status & UART_RX_IDLE)
+	{
+		uart->stats.rxIdleTick = timerGetTick();
+	}
+#endif
 }
 
 /**
- * @brief Write Byte UART
+ * @brief UART Receive Interrupt Handler, store received byte in the Ring Buffer
+ * Count Receive Errors and Idle Line, also called from SCIx Error ISR
+ * @param uartId UART Id
+ */
+void uartReceiveInterrupt(uchar uartId)
+{
+	uartStructHandle *uart;
+	uchar readByte;
+	uchar status;
+	uchar head;
+	uchar level;
+#ifdef UART_ISR_PROFILE
+	uint startCount;
+	uint elapsedCount;
+
+	startCount = timerGetCount();
+#endif
+
+	uart = &uartHandle[uartId - 1];
+
+	// Read Received Byte and clear Error Flags
+	status = _hal_uartReceiveData(uart->registerBase, &readByte);
+
+	if(status & (UART_RX_ERROR | UART_RX_IDLE))
+	{
+		uartReceiveStatus(uart, status);
+	}
+
+	if(status & UART_RX_DATA)
+	{
+		uart->stats.rxBytes++;
+
+		head = uart->rxBuffer.head;
+
+		if(uart->linePool)
+		{
+			uartReceiveLineByte(uart, readByte);
+		}
+		// Discard byte if the buffer is full
+		else if(((head + 1) & UART_RX_BUFFER_MASK) == uart->rxBuffer.tail)
+		{
+			uart->stats.rxOverrun++;
+		}
+		else
+		{
+			uart->rxBuffer.buffer[head] = readByte;
+			uart->rxBuffer.head = (head + 1) & UART_RX_BUFFER_MASK;
+
+			// Track Receive Buffer maximum fill level
+			level = (head + 1 - uart->rxBuffer.tail) & UART_RX_BUFFER_MASK;
+
+			if(level > uart->stats.rxBufferPeak)
+			{
+				uart->stats.rxBufferPeak = level;
+			}
+		}
+	}
+
+#ifdef UART_ISR_PROFILE
+	// Worst-Case RX ISR Duration
+	elapsedCount = timerElapsed(startCount);
+
+	if(elapsedCount > uart->stats.rxIsrMaxCount)
+	{
+		uart->stats.rxIsrMaxCount = elapsedCount;
+	}
+#endif
+}
+
+/**
+ * @brief Write Byte UART, polling the transmitter
+ * @param uart UART Handle
  * @param writeByte Byte to Write
  */
-void uartWriteByte(uchar writeByte)
+void uartWriteByte(uartStructHandle *uart, uchar writeByte)
+{
+	_hal_uartWriteByte(uart->registerBase, writeByte);
+}
+
+/**
+ * @brief Queue Bytes to Transmit without blocking
+ * @param uart UART Handle
+ * @param buffer Bytes to Transmit
+ * @param length Quantity Bytes to Transmit
+ * @return Quantity Bytes Queued
+ */
+uchar uartWriteBuffer(uartStructHandle *uart, const uchar *buffer, uchar length)
 {
-	_hal_uartWriteByte(writeByte);
+	uartStructTxQueue *txQueue;
+	uchar head;
+	uchar qtyWrite;
+
+	txQueue = &uart->txQueue;
+	head = txQueue->head;
+	qtyWrite = 0;
+
+	// Copy bytes until the queue is full or the source is empty
+	while(qtyWrite < length && ((head + 1) & UART_TX_BUFFER_MASK) != txQueue->tail)
+	{
+		txQueue->buffer[head] = buffer[qtyWrite];
+		head = (head + 1) & UART_TX_BUFFER_MASK;
+		qtyWrite++;
+	}
+
+	if(qtyWrite)
+	{
+		// Publish queued bytes and start the TX ISR
+		txQueue->head = head;
+		_hal_uartWriteInterrupt(uart->registerBase, ON);
+	}
+
+	return qtyWrite;
+}
+
+/**
+ * @brief Free Space in UART Transmit Queue
+ * @param uart UART Handle
+ * @return Quantity Bytes that can be Queued
+ */
+uchar uartWriteFree(uartStructHandle *uart)
+{
+	return (uart->txQueue.tail - uart->txQueue.head - 1) & UART_TX_BUFFER_MASK;
+}
+
+/**
+ * @brief Wait until UART Transmit Queue is empty
+ * @param uart UART Handle
+ */
+void uartFlush(uartStructHandle *uart)
+{
+	while(uart->txQueue.tail != uart->txQueue.head);
+}
+
+/**
+ * @brief Set Function called from TX ISR when the Transmit Queue is drained
+ * @param uart UART Handle
+ * @param callback Write Complete Function, 0 to disable
+ */
+void uartWriteCompleteCallback(uartStructHandle *uart, void (*callback)(void))
+{
+	uart->txQueue.writeCompleteCallback = callback;
+}
+
+/**
+ * @brief UART Transmit Interrupt Handler, send next queued byte
+ * @param uartId UART Id
+ */
+void uartTransmitInterrupt(uchar uartId)
+{
+	uartStructHandle *uart;
+	uchar tail;
+
+	uart = &uartHandle[uartId - 1];
+
+	// Wait until the transmitter finishes the current byte
+	if(!_hal_uartTransmitReady(uart->registerBase))
+	{
+		return;
+	}
+
+	tail = uart->txQueue.tail;
+
+	if(tail == uart->txQueue.head)
+	{
+		// Queue drained, stop TX ISR
+		_hal_uartWriteInterrupt(uart->registerBase, OFF);
+
+		if(uart->txQueue.writeCompleteCallback)
+		{
+			uart->txQueue.writeCompleteCallback();
+		}
+	}
+	else
+	{
+		// Send Next Byte
+		_hal_uartTransmitData(uart->registerBase, uart->txQueue.buffer[tail]);
+		uart->txQueue.tail = (tail + 1) & UART_TX_BUFFER_MASK;
+		uart->stats.txBytes++;
+	}
 }
 
 /**
  * @brief Read Interrupt Enable/Disable
+ * @param uart UART Handle
+ * @param state Enabled or Disabled
  */
-void uartReadInterrupt(uchar state)
+void uartReadInterrupt(uartStructHandle *uart, uchar state)
 {
-	_hal_uartReadInterrupt(state);
+	_hal_uartReadInterrupt(uart->registerBase, state);
 }
 
 /**
- * @brief Write Interrupt Enable/Disable
+ * @brief Write Interrupt (Transmit Data Register Empty) Enable/Disable
+ * @param uart UART Handle
+ * @param state Enabled or Disabled
  */
-void uartWriteInterrupt(uchar state)
+void uartWriteInterrupt(uartStructHandle *uart, uchar state)
 {
-	_hal_uartWriteInterrupt(state);
+	_hal_uartWriteInterrupt(uart->registerBase, state);
 }